@@ -0,0 +1,133 @@
+//
+//  RCLGeometryCoreTests.c
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#include "RCLTest.h"
+#include <math.h>
+
+static void testStandardize(void) {
+	RCLExpectRect(RCLRectStandardize(RCLRectMake(10, 20, -5, -10)), RCLRectMake(5, 10, 5, 10));
+	RCLExpectRect(RCLRectStandardize(RCLRectMake(10, 20, 5, 10)), RCLRectMake(10, 20, 5, 10));
+
+	RCLExpect(RCLRectIsNull(RCLRectNull));
+	RCLExpect(!RCLRectIsNull(RCLRectMake(0, 0, 0, 0)));
+}
+
+static void testEdges(void) {
+	RCLRect rect = RCLRectMake(10, 20, 30, 40);
+
+	RCLExpectFloat(RCLRectGetEdge(rect, RCLRectMinXEdge), 10);
+	RCLExpectFloat(RCLRectGetEdge(rect, RCLRectMinYEdge), 20);
+	RCLExpectFloat(RCLRectGetEdge(rect, RCLRectMaxXEdge), 40);
+	RCLExpectFloat(RCLRectGetEdge(rect, RCLRectMaxYEdge), 60);
+
+	RCLExpectRect(RCLRectAlignEdge(rect, RCLRectMinXEdge, 5), RCLRectMake(5, 20, 30, 40));
+	RCLExpectRect(RCLRectAlignEdge(rect, RCLRectMaxXEdge, 100), RCLRectMake(70, 20, 30, 40));
+	RCLExpectRect(RCLRectAlignEdge(rect, RCLRectMinYEdge, 0), RCLRectMake(10, 0, 30, 40));
+	RCLExpectRect(RCLRectAlignEdge(rect, RCLRectMaxYEdge, 50), RCLRectMake(10, 10, 30, 40));
+}
+
+static void testDivide(void) {
+	RCLRect slice, remainder;
+
+	RCLRectDivide(RCLRectMake(10, 20, 30, 40), &slice, &remainder, 15, RCLRectMinXEdge);
+	RCLExpectRect(slice, RCLRectMake(10, 20, 15, 40));
+	RCLExpectRect(remainder, RCLRectMake(25, 20, 15, 40));
+
+	RCLRectDivide(RCLRectMake(10, 20, 30, 40), &slice, &remainder, 15, RCLRectMaxYEdge);
+	RCLExpectRect(slice, RCLRectMake(10, 45, 30, 15));
+	RCLExpectRect(remainder, RCLRectMake(10, 20, 30, 25));
+
+	// Amounts are clamped to the size of the rect.
+	RCLRectDivide(RCLRectMake(0, 0, 10, 10), &slice, &remainder, 20, RCLRectMaxXEdge);
+	RCLExpectRect(slice, RCLRectMake(0, 0, 10, 10));
+	RCLExpectRect(remainder, RCLRectMake(0, 0, 0, 10));
+
+	RCLRectDivide(RCLRectMake(0, 0, 10, 10), &slice, &remainder, -5, RCLRectMinYEdge);
+	RCLExpectRect(slice, RCLRectMake(0, 0, 10, 0));
+	RCLExpectRect(remainder, RCLRectMake(0, 0, 10, 10));
+
+	RCLRectDivide(RCLRectNull, &slice, &remainder, 5, RCLRectMinXEdge);
+	RCLExpect(RCLRectIsNull(slice));
+	RCLExpect(RCLRectIsNull(remainder));
+}
+
+static void testDivideWithPadding(void) {
+	RCLRect slice, remainder;
+
+	RCLRectDivideWithPadding(RCLRectMake(25, 15, 45, 35), &slice, &remainder, 15, 3, RCLRectMinXEdge);
+	RCLExpectRect(slice, RCLRectMake(25, 15, 15, 35));
+	RCLExpectRect(remainder, RCLRectMake(43, 15, 27, 35));
+
+	RCLRectDivideWithPadding(RCLRectMake(0, 0, 10, 10), NULL, &remainder, 8, 5, RCLRectMinXEdge);
+	RCLExpectRect(remainder, RCLRectMake(10, 0, 0, 10));
+}
+
+static void testGrow(void) {
+	RCLRect rect = RCLRectMake(10, 10, 20, 20);
+
+	RCLExpectRect(RCLRectGrow(rect, -5, RCLRectMinXEdge), RCLRectMake(15, 10, 15, 20));
+	RCLExpectRect(RCLRectGrow(rect, -5, RCLRectMaxXEdge), RCLRectMake(10, 10, 15, 20));
+	RCLExpectRect(RCLRectGrow(rect, 5, RCLRectMinYEdge), RCLRectMake(10, 5, 20, 25));
+	RCLExpectRect(RCLRectGrow(rect, -30, RCLRectMaxYEdge), RCLRectMake(10, 0, 20, 10));
+}
+
+static void testOffset(void) {
+	RCLRect rect = RCLRectMake(10, 20, 30, 40);
+
+	RCLExpectRect(RCLRectOffsetTowardEdge(rect, 5, RCLRectMinXEdge), RCLRectMake(5, 20, 30, 40));
+	RCLExpectRect(RCLRectOffsetTowardEdge(rect, 5, RCLRectMaxXEdge), RCLRectMake(15, 20, 30, 40));
+	RCLExpectRect(RCLRectOffsetTowardEdge(rect, 5, RCLRectMinYEdge), RCLRectMake(10, 15, 30, 40));
+	RCLExpectRect(RCLRectOffsetTowardEdge(rect, 5, RCLRectMaxYEdge), RCLRectMake(10, 25, 30, 40));
+
+	RCLPoint point = RCLPointOffsetTowardEdge(rect.origin, -3, RCLRectMaxYEdge);
+	RCLExpectFloat(point.x, 10);
+	RCLExpectFloat(point.y, 17);
+}
+
+static void testInset(void) {
+	RCLEdgeInsets insets = RCLEdgeInsetsMake(2, 10, 4, 20);
+
+	RCLExpectRect(RCLRectInset(RCLRectMake(10, 20, 30, 40), insets, true, RCLRectNull), RCLRectMake(20, 22, 0, 34));
+	RCLExpectRect(RCLRectInset(RCLRectMake(10, 20, 30, 40), insets, false, RCLRectNull), RCLRectMake(20, 24, 0, 34));
+
+	// Insets larger than the rect result in the null rect.
+	RCLRect nullRect = RCLRectMake(1, 2, 3, 4);
+	RCLExpectRect(RCLRectInset(RCLRectMake(10, 10, 20, 20), insets, true, nullRect), nullRect);
+	RCLExpect(RCLRectIsNull(RCLRectInset(RCLRectMake(10, 10, 20, 20), insets, true, RCLRectNull)));
+}
+
+static void testAlignBaseline(void) {
+	RCLRect rect = RCLRectMake(0, 0, 50, 20);
+	RCLRect referenceRect = RCLRectMake(100, 100, 50, 40);
+
+	// With the Y axis pointing down, baselines are measured from the bottom,
+	// so a baseline of 5 in a 20pt rect is 15pt from the top.
+	RCLExpectRect(RCLRectAlignBaseline(rect, 5, referenceRect, 10, true), RCLRectMake(0, 115, 50, 20));
+
+	// Otherwise, baselines are measured from the minimum Y.
+	RCLExpectRect(RCLRectAlignBaseline(rect, 5, referenceRect, 10, false), RCLRectMake(0, 105, 50, 20));
+}
+
+static void testWritingDirection(void) {
+	RCLExpect(RCLLeadingEdge(false) == RCLRectMinXEdge);
+	RCLExpect(RCLTrailingEdge(false) == RCLRectMaxXEdge);
+	RCLExpect(RCLLeadingEdge(true) == RCLRectMaxXEdge);
+	RCLExpect(RCLTrailingEdge(true) == RCLRectMinXEdge);
+}
+
+void RCLGeometryCoreTests(void) {
+	testStandardize();
+	testEdges();
+	testDivide();
+	testDivideWithPadding();
+	testGrow();
+	testOffset();
+	testInset();
+	testAlignBaseline();
+	testWritingDirection();
+}
@@ -0,0 +1,178 @@
+//
+//  RCLGeometryKernelsTests.c
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#include "RCLTest.h"
+#include "RCLGeometryKernels.h"
+#include <math.h>
+#include <stdlib.h>
+
+// More than one iteration of the vectorized loops, plus a remainder.
+static const RCLFloat numbers[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5 };
+static const size_t numberCount = sizeof(numbers) / sizeof(*numbers);
+
+static void testReductions(void) {
+	RCLExpectFloat(RCLKernelSum(numbers, numberCount), 36);
+	RCLExpectFloat(RCLKernelSum(numbers, 0), 0);
+	RCLExpectFloat(RCLKernelMinimum(numbers, numberCount), 1);
+	RCLExpectFloat(RCLKernelMinimum(numbers, 0), INFINITY);
+	RCLExpectFloat(RCLKernelMaximum(numbers, numberCount), 9);
+	RCLExpectFloat(RCLKernelMaximum(numbers, 0), -INFINITY);
+}
+
+static void testRects(void) {
+	RCLRect rects[] = { RCLRectMake(0, 0, 10, 10), RCLRectNull, RCLRectMake(20, 5, -5, 10) };
+	RCLExpectRect(RCLKernelUnionRects(rects, 3), RCLRectMake(0, 0, 20, 15));
+	RCLExpect(RCLRectIsNull(RCLKernelUnionRects(rects + 1, 1)));
+
+	RCLRect results[3];
+	RCLKernelOffsetRects(rects, results, 1, 5, -5);
+	RCLExpectRect(results[0], RCLRectMake(5, -5, 10, 10));
+
+	RCLRect nullRect = RCLRectMake(1, 1, 1, 1);
+	RCLRect insetRects[] = { RCLRectMake(0, 0, 10, 10), RCLRectMake(0, 0, 2, 2) };
+	RCLKernelInsetRects(insetRects, results, 2, 1, 2, 3, 1, nullRect);
+	RCLExpectRect(results[0], RCLRectMake(1, 2, 6, 7));
+	RCLExpectRect(results[1], nullRect);
+}
+
+// Divides `rect` by chaining RCLRectDivideWithPadding(), as callers did before
+// RCLKernelDivideRect() existed.
+static void divideRectByChaining(RCLRect rect, const RCLFloat *amounts, size_t count, RCLFloat padding, RCLRectEdge edge, RCLRect *results) {
+	for (size_t i = 0; i < count; i++) {
+		RCLRectDivideWithPadding(rect, &results[i], &rect, amounts[i], padding, edge);
+	}
+}
+
+static void testDivision(void) {
+	enum { count = 5 };
+
+	RCLRect rect = RCLRectMake(10, 20, 100, 50);
+	RCLRect results[count];
+	RCLRect expected[count];
+
+	// The last amount overflows the rectangle.
+	const RCLFloat lengths[count] = { 10, 0, 25, 30, 40 };
+
+	const RCLRectEdge edges[] = { RCLRectMinXEdge, RCLRectMaxXEdge, RCLRectMinYEdge, RCLRectMaxYEdge };
+	for (size_t i = 0; i < sizeof(edges) / sizeof(*edges); i++) {
+		RCLKernelDivideRect(rect, lengths, count, 2, edges[i], RCLKernelDivisionFixed, results);
+		divideRectByChaining(rect, lengths, count, 2, edges[i], expected);
+
+		for (size_t j = 0; j < count; j++) {
+			RCLExpectRect(results[j], expected[j]);
+		}
+	}
+
+	// The last rectangle takes whatever is left over.
+	RCLKernelDivideRect(rect, lengths, 3, 5, RCLRectMinXEdge, RCLKernelDivisionFill, results);
+	RCLExpectRect(results[0], RCLRectMake(10, 20, 10, 50));
+	RCLExpectRect(results[1], RCLRectMake(25, 20, 0, 50));
+	RCLExpectRect(results[2], RCLRectMake(30, 20, 80, 50));
+
+	// 100 points, less 4 gaps of 5 points each, is 80 points to share out.
+	const RCLFloat weights[count] = { 1, 2, 0, 1, 4 };
+	RCLKernelDivideRect(rect, weights, count, 5, RCLRectMaxXEdge, RCLKernelDivisionProportional, results);
+	RCLExpectRect(results[0], RCLRectMake(100, 20, 10, 50));
+	RCLExpectRect(results[1], RCLRectMake(75, 20, 20, 50));
+	RCLExpectRect(results[2], RCLRectMake(70, 20, 0, 50));
+	RCLExpectRect(results[3], RCLRectMake(55, 20, 10, 50));
+	RCLExpectRect(results[4], RCLRectMake(10, 20, 40, 50));
+
+	// Weights which don't divide evenly still fill the rectangle exactly.
+	const RCLFloat thirds[3] = { 1, 1, 1 };
+	RCLKernelDivideRect(rect, thirds, 3, 0, RCLRectMinYEdge, RCLKernelDivisionProportional, results);
+	RCLExpectFloat(results[2].origin.y + results[2].size.height, 70);
+
+	// Without any weight, there's nothing to share out.
+	const RCLFloat zeroes[2] = { 0, 0 };
+	RCLKernelDivideRect(rect, zeroes, 2, 0, RCLRectMinXEdge, RCLKernelDivisionProportional, results);
+	RCLExpectRect(results[0], RCLRectMake(10, 20, 0, 50));
+	RCLExpectRect(results[1], RCLRectMake(10, 20, 0, 50));
+
+	RCLKernelDivideRect(RCLRectNull, lengths, 2, 0, RCLRectMinXEdge, RCLKernelDivisionFixed, results);
+	RCLExpect(RCLRectIsNull(results[0]));
+	RCLExpect(RCLRectIsNull(results[1]));
+}
+
+// Compares a reducer against a naive reduction, over random updates.
+static void testReducerAgainstNaiveReduction(RCLKernelReduction reduction) {
+	enum { count = 37, steps = 500 };
+
+	RCLFloat values[count];
+	bool present[count] = { false };
+
+	RCLKernelReducer *reducer = RCLKernelReducerCreate(reduction, count, 1);
+	RCLExpect(reducer != NULL);
+	if (reducer == NULL) return;
+
+	srand(42);
+
+	for (int step = 0; step < steps; step++) {
+		size_t index = (size_t)rand() % count;
+
+		if (rand() % 4 == 0) {
+			present[index] = false;
+			RCLKernelReducerRemoveValue(reducer, index);
+		} else {
+			present[index] = true;
+			values[index] = (RCLFloat)(rand() % 1000) - 500;
+			RCLKernelReducerSetValue(reducer, index, &values[index]);
+		}
+
+		RCLFloat expected = (reduction == RCLKernelReductionSum ? 0 : (reduction == RCLKernelReductionMinimum ? INFINITY : -INFINITY));
+		size_t expectedCount = 0;
+
+		for (size_t i = 0; i < count; i++) {
+			if (!present[i]) continue;
+
+			expectedCount++;
+
+			if (reduction == RCLKernelReductionSum) {
+				expected += values[i];
+			} else if (reduction == RCLKernelReductionMinimum) {
+				expected = fmin(expected, values[i]);
+			} else {
+				expected = fmax(expected, values[i]);
+			}
+		}
+
+		RCLFloat result;
+		RCLKernelReducerGetResult(reducer, &result);
+
+		RCLExpectFloat(result, expected);
+		RCLExpect(RCLKernelReducerValueCount(reducer) == expectedCount);
+	}
+
+	RCLKernelReducerFree(reducer);
+}
+
+static void testReducers(void) {
+	testReducerAgainstNaiveReduction(RCLKernelReductionSum);
+	testReducerAgainstNaiveReduction(RCLKernelReductionMinimum);
+	testReducerAgainstNaiveReduction(RCLKernelReductionMaximum);
+
+	RCLKernelReducer *reducer = RCLKernelReducerCreate(RCLKernelReductionSum, 2, 2);
+	RCLFloat first[] = { 1, 2 };
+	RCLFloat second[] = { 10, 20 };
+	RCLKernelReducerSetValue(reducer, 0, first);
+	RCLKernelReducerSetValue(reducer, 1, second);
+
+	RCLFloat result[2];
+	RCLKernelReducerGetResult(reducer, result);
+	RCLExpectFloat(result[0], 11);
+	RCLExpectFloat(result[1], 22);
+
+	RCLKernelReducerFree(reducer);
+}
+
+void RCLGeometryKernelsTests(void) {
+	testReductions();
+	testRects();
+	testDivision();
+	testReducers();
+}
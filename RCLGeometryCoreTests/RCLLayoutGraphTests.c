@@ -0,0 +1,235 @@
+//
+//  RCLLayoutGraphTests.c
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#include "RCLTest.h"
+#include "RCLLayoutGraph.h"
+#include "RCLGeometryKernels.h"
+#include <stdlib.h>
+
+// Each component is a source, followed by a chain of offsets, ending in the
+// union of the source and the last offset. This adds up to more than 10,000
+// nodes.
+enum {
+	componentCount = 200,
+	offsetCount = 58,
+	nodesPerComponent = offsetCount + 2
+};
+
+// The number of times each node's function has been invoked.
+//
+// Each node is only ever evaluated by one thread at a time, so these don't
+// need to be atomic.
+typedef struct {
+	unsigned evaluationCount;
+} RCLTestNodeContext;
+
+static RCLRect offsetByOne(const RCLRect *inputs, size_t inputCount, void *context) {
+	RCLExpect(inputCount == 1);
+
+	((RCLTestNodeContext *)context)->evaluationCount++;
+	return RCLRectOffsetTowardEdge(inputs[0], 1, RCLRectMaxXEdge);
+}
+
+static RCLRect unionInputs(const RCLRect *inputs, size_t inputCount, void *context) {
+	((RCLTestNodeContext *)context)->evaluationCount++;
+	return RCLKernelUnionRects(inputs, inputCount);
+}
+
+static RCLRect sourceRectForComponent(size_t component) {
+	return RCLRectMake((RCLFloat)component, 0, 10, 10);
+}
+
+// Builds the synthetic graph described above.
+//
+// The nodes of different components are interleaved, so that no component's
+// nodes are contiguous.
+//
+// contexts - Storage for one context per node.
+// sources  - Filled in with the source of each component.
+// results  - Filled in with the final node of each component.
+static RCLLayoutGraph *createGraph(RCLTestNodeContext *contexts, RCLLayoutNode *sources, RCLLayoutNode *results) {
+	RCLLayoutGraph *graph = RCLLayoutGraphCreate();
+	if (graph == NULL) return NULL;
+
+	RCLLayoutNode previous[componentCount];
+
+	for (size_t component = 0; component < componentCount; component++) {
+		sources[component] = RCLLayoutGraphAddSource(graph, sourceRectForComponent(component));
+		previous[component] = sources[component];
+	}
+
+	for (size_t step = 0; step < offsetCount; step++) {
+		for (size_t component = 0; component < componentCount; component++) {
+			RCLLayoutNode node = RCLLayoutGraphNodeCount(graph);
+			previous[component] = RCLLayoutGraphAddNode(graph, &previous[component], 1, &offsetByOne, &contexts[node]);
+		}
+	}
+
+	for (size_t component = 0; component < componentCount; component++) {
+		RCLLayoutNode inputs[] = { sources[component], previous[component] };
+		RCLLayoutNode node = RCLLayoutGraphNodeCount(graph);
+		results[component] = RCLLayoutGraphAddNode(graph, inputs, 2, &unionInputs, &contexts[node]);
+	}
+
+	return graph;
+}
+
+static void testStructure(void) {
+	RCLLayoutGraph *graph = RCLLayoutGraphCreate();
+	RCLExpect(graph != NULL);
+	if (graph == NULL) return;
+
+	RCLTestNodeContext context = { 0 };
+
+	RCLLayoutNode a = RCLLayoutGraphAddSource(graph, RCLRectMake(0, 0, 1, 1));
+	RCLLayoutNode b = RCLLayoutGraphAddSource(graph, RCLRectMake(5, 5, 1, 1));
+	RCLLayoutNode c = RCLLayoutGraphAddSource(graph, RCLRectMake(9, 9, 1, 1));
+	RCLExpect(RCLLayoutGraphNodeCount(graph) == 3);
+	RCLExpect(RCLLayoutGraphComponentCount(graph) == 3);
+
+	RCLLayoutNode inputs[] = { a, b };
+	RCLLayoutNode ab = RCLLayoutGraphAddNode(graph, inputs, 2, &unionInputs, &context);
+	RCLExpect(RCLLayoutGraphNodeCount(graph) == 4);
+	RCLExpect(RCLLayoutGraphComponentCount(graph) == 2);
+
+	// Nothing is visible until the graph has been evaluated.
+	RCLExpect(RCLRectIsNull(RCLLayoutGraphGetRect(graph, ab)));
+	RCLExpect(RCLRectIsNull(RCLLayoutGraphGetRect(graph, c)));
+
+	RCLExpect(RCLLayoutGraphEvaluate(graph, 2));
+	RCLExpectRect(RCLLayoutGraphGetRect(graph, ab), RCLRectMake(0, 0, 6, 6));
+	RCLExpectRect(RCLLayoutGraphGetRect(graph, c), RCLRectMake(9, 9, 1, 1));
+	RCLExpect(context.evaluationCount == 1);
+
+	// Changes are only visible after the next evaluation.
+	RCLLayoutGraphSetSourceRect(graph, c, RCLRectMake(0, 0, 2, 2));
+	RCLExpectRect(RCLLayoutGraphGetRect(graph, c), RCLRectMake(9, 9, 1, 1));
+
+	RCLExpect(RCLLayoutGraphEvaluate(graph, 2));
+	RCLExpectRect(RCLLayoutGraphGetRect(graph, c), RCLRectMake(0, 0, 2, 2));
+	RCLExpect(context.evaluationCount == 1);
+
+	RCLLayoutGraphFree(graph);
+}
+
+static void testEmptyGraph(void) {
+	RCLLayoutGraph *graph = RCLLayoutGraphCreate();
+	RCLExpect(graph != NULL);
+	if (graph == NULL) return;
+
+	RCLExpect(RCLLayoutGraphComponentCount(graph) == 0);
+	RCLExpect(RCLLayoutGraphEvaluate(graph, 4));
+
+	RCLLayoutGraphFree(graph);
+}
+
+// Evaluates the synthetic graph with the given number of threads, and checks
+// every component's result.
+static void testLargeGraphWithThreadCount(unsigned threadCount) {
+	enum { nodeCount = componentCount * nodesPerComponent };
+
+	RCLTestNodeContext *contexts = calloc(nodeCount, sizeof(*contexts));
+	RCLLayoutNode sources[componentCount];
+	RCLLayoutNode results[componentCount];
+
+	RCLLayoutGraph *graph = (contexts != NULL ? createGraph(contexts, sources, results) : NULL);
+	RCLExpect(graph != NULL);
+	if (graph == NULL) {
+		free(contexts);
+		return;
+	}
+
+	RCLExpect(RCLLayoutGraphNodeCount(graph) == nodeCount);
+	RCLExpect(RCLLayoutGraphComponentCount(graph) == componentCount);
+
+	RCLExpect(RCLLayoutGraphEvaluate(graph, threadCount));
+
+	for (size_t component = 0; component < componentCount; component++) {
+		RCLRect expected = RCLRectMake((RCLFloat)component, 0, offsetCount + 10, 10);
+		RCLExpectRect(RCLLayoutGraphGetRect(graph, results[component]), expected);
+		RCLExpectRect(RCLLayoutGraphGetRect(graph, sources[component]), sourceRectForComponent(component));
+	}
+
+	for (size_t node = 0; node < nodeCount; node++) {
+		bool isSource = (node < componentCount);
+		RCLExpect(contexts[node].evaluationCount == (isSource ? 0 : 1));
+	}
+
+	// Evaluating again without any changes does nothing.
+	RCLExpect(RCLLayoutGraphEvaluate(graph, threadCount));
+
+	for (size_t node = componentCount; node < nodeCount; node++) {
+		RCLExpect(contexts[node].evaluationCount == 1);
+	}
+
+	// Changing one source only re-evaluates its own component.
+	const size_t changedComponent = 17;
+	RCLLayoutGraphSetSourceRect(graph, sources[changedComponent], RCLRectMake(-100, 50, 10, 10));
+	RCLExpect(RCLLayoutGraphEvaluate(graph, threadCount));
+
+	RCLExpectRect(RCLLayoutGraphGetRect(graph, results[changedComponent]), RCLRectMake(-100, 50, offsetCount + 10, 10));
+	RCLExpectRect(RCLLayoutGraphGetRect(graph, results[changedComponent + 1]), RCLRectMake(changedComponent + 1, 0, offsetCount + 10, 10));
+
+	unsigned reevaluatedCount = 0;
+	for (size_t node = componentCount; node < nodeCount; node++) {
+		if (contexts[node].evaluationCount == 2) reevaluatedCount++;
+	}
+
+	RCLExpect(reevaluatedCount == nodesPerComponent - 1);
+
+	RCLLayoutGraphFree(graph);
+	free(contexts);
+}
+
+// Evaluates one graph many times, with more and fewer threads than its pool
+// already has.
+static void testReusedPool(void) {
+	enum { nodeCount = componentCount * nodesPerComponent };
+
+	RCLTestNodeContext *contexts = calloc(nodeCount, sizeof(*contexts));
+	RCLLayoutNode sources[componentCount];
+	RCLLayoutNode results[componentCount];
+
+	RCLLayoutGraph *graph = (contexts != NULL ? createGraph(contexts, sources, results) : NULL);
+	RCLExpect(graph != NULL);
+	if (graph == NULL) {
+		free(contexts);
+		return;
+	}
+
+	const unsigned threadCounts[] = { 2, 8, 4, 1, 8 };
+	const size_t passCount = 100;
+
+	for (size_t pass = 0; pass < passCount; pass++) {
+		for (size_t component = 0; component < componentCount; component++) {
+			RCLLayoutGraphSetSourceRect(graph, sources[component], RCLRectMake((RCLFloat)pass, (RCLFloat)component, 10, 10));
+		}
+
+		unsigned threadCount = threadCounts[pass % (sizeof(threadCounts) / sizeof(*threadCounts))];
+		RCLExpect(RCLLayoutGraphEvaluate(graph, threadCount));
+
+		RCLExpectRect(RCLLayoutGraphGetRect(graph, results[0]), RCLRectMake((RCLFloat)pass, 0, offsetCount + 10, 10));
+		RCLExpectRect(RCLLayoutGraphGetRect(graph, results[componentCount - 1]), RCLRectMake((RCLFloat)pass, componentCount - 1, offsetCount + 10, 10));
+	}
+
+	for (size_t node = componentCount; node < nodeCount; node++) {
+		RCLExpect(contexts[node].evaluationCount == passCount);
+	}
+
+	RCLLayoutGraphFree(graph);
+	free(contexts);
+}
+
+void RCLLayoutGraphTests(void) {
+	testStructure();
+	testEmptyGraph();
+	testLargeGraphWithThreadCount(1);
+	testLargeGraphWithThreadCount(4);
+	testLargeGraphWithThreadCount(64);
+	testReusedPool();
+}
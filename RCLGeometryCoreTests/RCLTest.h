@@ -0,0 +1,60 @@
+//
+//  RCLTest.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#ifndef RCL_TEST_H
+#define RCL_TEST_H
+
+// A minimal harness for the geometry core's unit tests, which need to run
+// without XCTest or Quick.
+
+#include "RCLGeometryCore.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+// The number of failed expectations so far.
+extern unsigned RCLTestFailureCount;
+
+// Records a failure at the given location.
+void RCLTestRecordFailure(const char *file, int line, const char *format, ...);
+
+// Fails the current test if `condition` is false.
+#define RCLExpect(condition) \
+	do { \
+		if (!(condition)) RCLTestRecordFailure(__FILE__, __LINE__, "expected %s", #condition); \
+	} while (0)
+
+// Fails the current test if two numbers are not equal.
+#define RCLExpectFloat(actual, expected) \
+	do { \
+		double _actual = (actual); \
+		double _expected = (expected); \
+		if (_actual != _expected) RCLTestRecordFailure(__FILE__, __LINE__, "expected %s to be %g, got %g", #actual, _expected, _actual); \
+	} while (0)
+
+// Fails the current test if two RCLRects are not equal.
+#define RCLExpectRect(actual, expected) \
+	do { \
+		RCLRect _actual = (actual); \
+		RCLRect _expected = (expected); \
+		if (!RCLRectEqualToRect(_actual, _expected)) { \
+			RCLTestRecordFailure(__FILE__, __LINE__, "expected %s to be {%g, %g, %g, %g}, got {%g, %g, %g, %g}", #actual, \
+				(double)_expected.origin.x, (double)_expected.origin.y, (double)_expected.size.width, (double)_expected.size.height, \
+				(double)_actual.origin.x, (double)_actual.origin.y, (double)_actual.size.width, (double)_actual.size.height); \
+		} \
+	} while (0)
+
+// Runs the tests for RCLGeometryCore.
+void RCLGeometryCoreTests(void);
+
+// Runs the tests for RCLGeometryKernels.
+void RCLGeometryKernelsTests(void);
+
+// Runs the tests for RCLLayoutGraph.
+void RCLLayoutGraphTests(void);
+
+#endif
@@ -0,0 +1,40 @@
+//
+//  main.c
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#include "RCLTest.h"
+#include <stdarg.h>
+#include <stdlib.h>
+
+unsigned RCLTestFailureCount = 0;
+
+void RCLTestRecordFailure(const char *file, int line, const char *format, ...) {
+	RCLTestFailureCount++;
+
+	fprintf(stderr, "%s:%d: error: ", file, line);
+
+	va_list args;
+	va_start(args, format);
+	vfprintf(stderr, format, args);
+	va_end(args);
+
+	fputc('\n', stderr);
+}
+
+int main(void) {
+	RCLGeometryCoreTests();
+	RCLGeometryKernelsTests();
+	RCLLayoutGraphTests();
+
+	if (RCLTestFailureCount > 0) {
+		fprintf(stderr, "%u expectation(s) failed\n", RCLTestFailureCount);
+		return EXIT_FAILURE;
+	}
+
+	printf("All geometry core tests passed\n");
+	return EXIT_SUCCESS;
+}
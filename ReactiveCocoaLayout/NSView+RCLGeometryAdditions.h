@@ -29,6 +29,9 @@
 // the receiver's backing store. If set from within an animated signal, the
 // receiver's -animator proxy is automatically used.
 //
+// Outside of an animation, a rect which aligns to the current frame is not
+// assigned at all.
+//
 // This property may have `RAC()` bindings applied to it, but it is not
 // KVO-compliant. Use -rcl_frameSignal for observing changes instead.
 @property (nonatomic, assign) CGRect rcl_frame;
@@ -37,7 +40,8 @@
 //
 // Setting this property to a given rect will automatically align the rect with
 // the receiver's backing store. If set from within an animated signal, the
-// receiver's -animator proxy is automatically used.
+// receiver's -animator proxy is automatically used. Otherwise, a rect which
+// aligns to the current bounds is not assigned at all.
 //
 // This property may have `RAC()` bindings applied to it, but it is not
 // KVO-compliant. Use -rcl_boundsSignal for observing changes instead.
@@ -57,6 +61,9 @@
 // This property is mostly for the convenience of bindings (because -isHidden
 // does not work in a key path), and may have `RAC()` applied to it, but it is
 // not KVO-compliant.
+//
+// Showing the receiver this way first lays out any lazy bindings within it.
+// See +[RCLRectAssignmentTrampoline setLazyLayoutScheduler:].
 @property (nonatomic, assign, getter = rcl_isHidden) BOOL rcl_hidden;
 
 // Observes the receiver's `bounds` for changes.
@@ -81,6 +88,9 @@
 // size changes. Operations which affect the baseline but _not_ the intrinsic
 // content size may not result in a new value being sent.
 //
+// The same signal is returned each time, and shares one computation between
+// all of its subscribers.
+//
 // Returns a signal of baseline offsets from the minimum Y edge of the receiver.
 - (RACSignal *)rcl_baselineSignal;
 
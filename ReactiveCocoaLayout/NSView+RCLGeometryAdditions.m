@@ -8,12 +8,151 @@
 
 #import "NSView+RCLGeometryAdditions.h"
 #import "RACSignal+RCLAnimationAdditions.h"
+#import "RACSignal+RCLGeometryAdditions.h"
+#import "RCLMacros.h"
+#import "RCLSharedSignal.h"
+#import "RCLViewGeometryDispatcher.h"
 #import "View+RCLAutoLayoutAdditions.h"
 #import <Archimedes/Archimedes.h>
 #import <objc/runtime.h>
 #import <ReactiveCocoa/EXTScope.h>
 #import <ReactiveCocoa/ReactiveCocoa.h>
 
+// Matches the behavior of MEDRectFloor().
+static const NSAlignmentOptions RCLBackingAlignmentOptions = NSAlignMinXOutward | NSAlignMinYInward | NSAlignWidthInward | NSAlignHeightInward;
+
+// The associated object key for a view's RCLBackingTransform.
+static void *RCLBackingTransformKey = &RCLBackingTransformKey;
+
+// Maps a view's coordinate system to the pixels of its window's backing store.
+//
+// A view's transform depends upon its own frame and bounds, its position in the
+// view hierarchy, the geometry of all of its ancestors, and the backing scale
+// of its window. Rather than observing all of those, the transform remembers
+// where a unit square in the view lands in window coordinates, which reflects
+// every one of them, and is only recomputed once that changes.
+@interface RCLBackingTransform : NSObject
+
+// The view's window when the transform was computed.
+//
+// This is only compared by address, and never messaged, because windows may
+// not support weak references.
+@property (nonatomic, unsafe_unretained) NSWindow *window;
+
+// The backing scale of `window` when the transform was computed.
+@property (nonatomic, assign) CGFloat backingScale;
+
+// The unit square at the view's origin, converted to window coordinates, when
+// the transform was computed.
+@property (nonatomic, assign) CGRect windowUnitRect;
+
+// Whether the transform could be represented by the scales and translations
+// below. If not, the view or one of its ancestors is rotated.
+@property (nonatomic, assign, getter = isAxisAligned) BOOL axisAligned;
+
+// A pixel coordinate is `scale * viewCoordinate + translation` on each axis.
+@property (nonatomic, assign) CGFloat scaleX;
+@property (nonatomic, assign) CGFloat scaleY;
+@property (nonatomic, assign) CGFloat translationX;
+@property (nonatomic, assign) CGFloat translationY;
+
+@end
+
+@implementation RCLBackingTransform
+
+@end
+
+// Maps the pixel range from `pixelMin` to `pixelMax` back into a view's
+// coordinate system, returning the origin and storing the length into
+// `length`.
+static CGFloat RCLViewRangeFromPixels(CGFloat pixelMin, CGFloat pixelMax, CGFloat scale, CGFloat translation, CGFloat *length) {
+	CGFloat a = (pixelMin - translation) / scale;
+	CGFloat b = (pixelMax - translation) / scale;
+
+	*length = fabs(b - a);
+	return fmin(a, b);
+}
+
+// Aligns `rect`, in the coordinate system of `view`, to the pixels of the
+// window's backing store.
+//
+// This is equivalent to converting `rect` to window coordinates, aligning it
+// with -backingAlignedRect:options:, and converting it back, but caches the
+// conversion upon `view` so that repeated assignments only perform one
+// conversion and a few multiplications.
+//
+// Returns `rect` unmodified if `view` is not in a window.
+static CGRect RCLBackingAlignedRect(NSView *view, CGRect rect) {
+	NSCParameterAssert(view != nil);
+
+	NSWindow *window = view.window;
+	if (window == nil) return rect;
+
+	// Converting one rect walks the whole ancestor chain, so this notices
+	// changes to any ancestor, including ones which post no notifications.
+	CGFloat backingScale = window.backingScaleFactor;
+	CGRect windowUnitRect = [view convertRect:CGRectMake(0, 0, 1, 1) toView:nil];
+
+	RCLBackingTransform *transform = objc_getAssociatedObject(view, RCLBackingTransformKey);
+	BOOL valid = transform != nil
+		&& transform.window == window
+		&& transform.backingScale == backingScale
+		&& CGRectEqualToRect(transform.windowUnitRect, windowUnitRect);
+
+	if (!valid) {
+		if (transform == nil) {
+			transform = [[RCLBackingTransform alloc] init];
+			objc_setAssociatedObject(view, RCLBackingTransformKey, transform, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+		}
+
+		transform.window = window;
+		transform.backingScale = backingScale;
+		transform.windowUnitRect = windowUnitRect;
+
+		// Convert the unit vectors to find the scale and translation on each
+		// axis.
+		CGPoint origin = [view convertPoint:CGPointZero toView:nil];
+		CGPoint unitX = [view convertPoint:CGPointMake(1, 0) toView:nil];
+		CGPoint unitY = [view convertPoint:CGPointMake(0, 1) toView:nil];
+
+		transform.axisAligned = (unitX.y == origin.y && unitY.x == origin.x);
+
+		transform.scaleX = (unitX.x - origin.x) * backingScale;
+		transform.scaleY = (unitY.y - origin.y) * backingScale;
+		transform.translationX = origin.x * backingScale;
+		transform.translationY = origin.y * backingScale;
+	}
+
+	if (!transform.axisAligned || transform.scaleX == 0 || transform.scaleY == 0) {
+		CGRect windowRect = [view convertRect:rect toView:nil];
+		CGRect alignedWindowRect = [view backingAlignedRect:windowRect options:RCLBackingAlignmentOptions];
+		return [view convertRect:alignedWindowRect fromView:nil];
+	}
+
+	CGFloat scaleX = transform.scaleX;
+	CGFloat scaleY = transform.scaleY;
+	CGFloat translationX = transform.translationX;
+	CGFloat translationY = transform.translationY;
+
+	// Either axis may be flipped, so find the minimum edges in pixel space.
+	CGFloat minX = fmin(scaleX * CGRectGetMinX(rect), scaleX * CGRectGetMaxX(rect)) + translationX;
+	CGFloat minY = fmin(scaleY * CGRectGetMinY(rect), scaleY * CGRectGetMaxY(rect)) + translationY;
+	CGFloat width = fabs(scaleX) * CGRectGetWidth(rect);
+	CGFloat height = fabs(scaleY) * CGRectGetHeight(rect);
+
+	// The same rounding as RCLBackingAlignmentOptions.
+	minX = floor(minX);
+	minY = ceil(minY);
+	width = floor(width);
+	height = floor(height);
+
+	CGRect aligned;
+	aligned.origin.x = RCLViewRangeFromPixels(minX, minX + width, scaleX, translationX, &aligned.size.width);
+	aligned.origin.y = RCLViewRangeFromPixels(minY, minY + height, scaleY, translationY, &aligned.size.height);
+
+	return aligned;
+}
+
 @implementation NSView (RCLGeometryAdditions)
 
 #pragma mark Properties
@@ -31,18 +170,14 @@
 }
 
 - (void)setRcl_frame:(CGRect)frame {
-	if (self.superview != nil && self.window != nil) {
-		// Matches the behavior of MEDRectFloor().
-		NSAlignmentOptions options = NSAlignMinXOutward | NSAlignMinYInward | NSAlignWidthInward | NSAlignHeightInward;
-
-		CGRect windowFrame = [self.superview convertRect:frame toView:nil];
-		CGRect alignedWindowFrame = [self backingAlignedRect:windowFrame options:options];
-		frame = [self.superview convertRect:alignedWindowFrame fromView:nil];
-	}
+	NSView *superview = self.superview;
+	if (superview != nil) frame = RCLBackingAlignedRect(superview, frame);
 
 	if (RCLIsInAnimatedSignal()) {
 		[self.animator setFrame:frame];
-	} else {
+	} else if (!CGRectEqualToRect(frame, self.frame)) {
+		// Rects which round to the same device pixels as the current frame
+		// would only cause a redundant notification and redisplay.
 		self.frame = frame;
 	}
 }
@@ -52,18 +187,11 @@
 }
 
 - (void)setRcl_bounds:(CGRect)bounds {
-	if (self.window != nil) {
-		// Matches the behavior of MEDRectFloor().
-		NSAlignmentOptions options = NSAlignMinXOutward | NSAlignMinYInward | NSAlignWidthInward | NSAlignHeightInward;
-
-		CGRect windowRect = [self convertRect:bounds toView:nil];
-		CGRect alignedWindowRect = [self backingAlignedRect:windowRect options:options];
-		bounds = [self convertRect:alignedWindowRect fromView:nil];
-	}
+	bounds = RCLBackingAlignedRect(self, bounds);
 
 	if (RCLIsInAnimatedSignal()) {
 		[self.animator setBounds:bounds];
-	} else {
+	} else if (!CGRectEqualToRect(bounds, self.bounds)) {
 		self.bounds = bounds;
 	}
 }
@@ -85,6 +213,10 @@
 }
 
 - (void)setRcl_hidden:(BOOL)hidden {
+	// Catch up on any layout that was skipped while hidden, before the view
+	// can be seen.
+	if (!hidden) [RCLRectAssignmentTrampoline layoutViewIfNeeded:self];
+
 	self.hidden = hidden;
 }
 
@@ -100,18 +232,22 @@
 	self.postsBoundsChangedNotifications = YES;
 	self.postsFrameChangedNotifications = YES;
 
-	RACDisposable *disposable = [[[[[RACSignal
-		merge:@[
-			[NSNotificationCenter.defaultCenter rac_addObserverForName:NSViewBoundsDidChangeNotification object:self],
-			[NSNotificationCenter.defaultCenter rac_addObserverForName:NSViewFrameDidChangeNotification object:self]
-		]]
-		map:^(NSNotification *notification) {
-			NSView *view = notification.object;
-			return MEDBox(view.bounds);
-		}]
-		startWith:MEDBox(self.bounds)]
-		distinctUntilChanged]
-		subscribe:subject];
+	__block CGRect lastBounds = self.bounds;
+	[subject sendNext:MEDBox(lastBounds)];
+
+	RACDisposable *disposable = [RCLViewGeometryDispatcher.sharedDispatcher observeView:self changes:RCLViewGeometryChangeFrame | RCLViewGeometryChangeBounds block:^(NSView *view, RCLViewGeometryChange change) {
+		CGRect bounds = view.bounds;
+		@synchronized (subject) {
+			if (CGRectEqualToRect(bounds, lastBounds)) return;
+			lastBounds = bounds;
+		}
+
+		// Treat each change as a transaction, so that layouts which depend
+		// upon the bounds in multiple ways are only updated once.
+		RCLPerformLayoutTransaction(^{
+			[subject sendNext:MEDBox(bounds)];
+		});
+	}];
 
 	[self.rac_deallocDisposable addDisposable:[RACDisposable disposableWithBlock:^{
 		[disposable dispose];
@@ -130,14 +266,20 @@
 
 	self.postsFrameChangedNotifications = YES;
 
-	RACDisposable *disposable = [[[[[NSNotificationCenter.defaultCenter rac_addObserverForName:NSViewFrameDidChangeNotification object:self]
-		map:^(NSNotification *notification) {
-			NSView *view = notification.object;
-			return MEDBox(view.frame);
-		}]
-		startWith:MEDBox(self.frame)]
-		distinctUntilChanged]
-		subscribe:subject];
+	__block CGRect lastFrame = self.frame;
+	[subject sendNext:MEDBox(lastFrame)];
+
+	RACDisposable *disposable = [RCLViewGeometryDispatcher.sharedDispatcher observeView:self changes:RCLViewGeometryChangeFrame block:^(NSView *view, RCLViewGeometryChange change) {
+		CGRect frame = view.frame;
+		@synchronized (subject) {
+			if (CGRectEqualToRect(frame, lastFrame)) return;
+			lastFrame = frame;
+		}
+
+		RCLPerformLayoutTransaction(^{
+			[subject sendNext:MEDBox(frame)];
+		});
+	}];
 
 	[self.rac_deallocDisposable addDisposable:[RACDisposable disposableWithBlock:^{
 		[disposable dispose];
@@ -148,20 +290,24 @@
 }
 
 - (RACSignal *)rcl_baselineSignal {
-	RACSubject *deallocSubject = [RACReplaySubject replaySubjectWithCapacity:1];
-	[self.rac_deallocDisposable addDisposable:[RACDisposable disposableWithBlock:^{
-		[deallocSubject sendCompleted];
-	}]];
+	RACSignal *signal = objc_getAssociatedObject(self, _cmd);
+	if (signal != nil) return signal;
 
 	@unsafeify(self);
 
-	return [[[self.rcl_intrinsicContentSizeSignal
-		map:^(id _) {
-			@strongify(self);
-			return @(self.baselineOffsetFromBottom);
-		}]
-		takeUntil:deallocSubject]
-		setNameWithFormat:@"%@ -rcl_baselineSignal", self];
+	// The intrinsic content size signal already completes when the receiver
+	// deallocates, so this doesn't need a dealloc disposable of its own.
+	RACSignal *baselines = [self.rcl_intrinsicContentSizeSignal map:^(id _) {
+		@strongify(self);
+		return @(self.baselineOffsetFromBottom);
+	}];
+
+	// Baselines are often requested by several sibling views, so share one
+	// computation between all of them.
+	signal = [[RCLSharedSignal signalWithSignal:baselines] setNameWithFormat:@"%@ -rcl_baselineSignal", self];
+	objc_setAssociatedObject(self, _cmd, signal, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+
+	return signal;
 }
 
 @end
@@ -9,9 +9,36 @@
 #import <ReactiveCocoa/ReactiveCocoa.h>
 #import <ReactiveCocoaLayout/View+RCLAutoLayoutAdditions.h>
 
+// How -divideWithAmounts:padding:fromEdge:mode: interprets its amounts.
+//
+// RCLDivisionModeFixed        - Each amount is the length of one rect, in
+//                               points.
+// RCLDivisionModeProportional - Each amount is the weight of one rect. The
+//                               length that's left after padding is shared
+//                               between the rects in proportion to their
+//                               weights.
+// RCLDivisionModeFill         - Like RCLDivisionModeFixed, but adds one more
+//                               rect after the others, which fills whatever
+//                               length remains.
+typedef enum : NSUInteger {
+	RCLDivisionModeFixed,
+	RCLDivisionModeProportional,
+	RCLDivisionModeFill
+} RCLDivisionMode;
+
 // Adds geometry functions to RACSignal.
 @interface RACSignal (RCLGeometryAdditions)
 
+// Returns a signal which sends `value` and completes, like +return:.
+//
+// Geometry operators fold constant signals into their calculations when they
+// are created, instead of subscribing to them. An operator whose inputs are
+// all constant (e.g., `[RCLBox(8) plus:RCLBox(2)]`) is itself constant.
+//
+// value - An NSNumber, or an NSValue containing a geometry structure. Other
+//         values are sent as-is, but will not be folded.
++ (RACSignal *)constant:(id)value;
+
 // Returns a signal which sends 0 and completes.
 + (RACSignal *)zero;
 
@@ -349,6 +376,12 @@
 // Divides each CGRect into two component rectangles, skipping an amount of
 // padding between them.
 //
+// Each division is computed once, and shared by the slice and remainder
+// signals. The inputs are only subscribed to once, no matter how many
+// subscriptions there are to either signal. To use only one of the rects, it's
+// cheaper to use -sliceWithAmount:fromEdge: or
+// -remainderAfterSlicingAmount:fromEdge:.
+//
 // sliceAmountSignal - A signal of CGFloat values, representing the number of
 //                     points to include in the slice rectangle, starting from
 //                     `edgeAttribute`. If greater than the size of a given
@@ -370,6 +403,33 @@
 // remainders, respectively.
 - (RACTuple *)divideWithAmount:(RACSignal *)sliceAmountSignal padding:(RACSignal *)paddingSignal fromEdge:(NSLayoutAttribute)edgeAttribute;
 
+// Divides each CGRect into any number of consecutive rectangles, skipping an
+// amount of padding between each of them.
+//
+// With fixed amounts, this gives the same results as chaining
+// -divideWithAmount:padding:fromEdge: upon each remainder, but all of the
+// rects are computed together, in one pass for each update. That pass is
+// shared by all of the returned signals, and the inputs are only subscribed to
+// once, no matter how many subscriptions there are to the returned signals.
+//
+// amountSignals - Signals of CGFloat values, one for each rect, which are
+//                 interpreted according to `mode`. This must contain at least
+//                 one signal.
+// paddingSignal - A signal of CGFloat values, representing the number of
+//                 points of padding to omit between consecutive rects.
+// edgeAttribute - A layout attribute representing the edge from which
+//                 division begins, proceeding toward the opposite edge. This
+//                 must be NSLayoutAttributeLeft, NSLayoutAttributeRight,
+//                 NSLayoutAttributeTop, NSLayoutAttributeBottom,
+//                 NSLayoutAttributeLeading, or NSLayoutAttributeTrailing.
+// mode          - How to interpret the values of `amountSignals`. Rects which
+//                 don't fit are clamped to the far edge, with a length of 0.
+//
+// Returns an array of signals of CGRects, in order from `edgeAttribute`. There
+// is one signal for each of `amountSignals`, plus one more if `mode` is
+// RCLDivisionModeFill.
+- (NSArray *)divideWithAmounts:(NSArray *)amountSignals padding:(RACSignal *)paddingSignal fromEdge:(NSLayoutAttribute)edgeAttribute mode:(RCLDivisionMode)mode;
+
 // Sends the maximum value, calculated using _only_ the most recently sent
 // values of all the given signals.
 //
@@ -614,4 +674,56 @@
 // Returns a signal of rounded values, using the same type as the input values.
 - (RACSignal *)ceil;
 
+// Like -distinctUntilChanged, but compares numbers and geometry structures
+// before they're boxed, so that repeated values never cause an allocation.
+//
+// This is equivalent to -distinctGeometryWithTolerance: with a tolerance of 0.
+//
+// Returns a signal of the same type of values as the receiver.
+- (RACSignal *)distinctGeometry;
+
+// Skips CGFloat, CGPoint, CGSize, CGRect, or MEDEdgeInsets values which are
+// equal to the last value sent, to within `tolerance`.
+//
+// Each value is compared to the last one sent, not the last one received, so
+// a series of small changes will eventually send a new value once they add up
+// to more than `tolerance`. This is useful for ignoring floating-point noise in
+// computed geometry, which would otherwise cause redundant layout.
+//
+// Values are compared without boxing them, and if the receiver was created by
+// geometry operators, the comparison is part of the same stage.
+//
+// tolerance - The largest difference in any component for which two values
+//             should be considered equal. This must not be negative.
+//
+// Returns a signal of the same type of values as the receiver.
+- (RACSignal *)distinctGeometryWithTolerance:(CGFloat)tolerance;
+
+// The number of stages that geometry operators have created between the
+// receiver and its inputs.
+//
+// Chains of geometry operators are fused into a single stage, which subscribes
+// to the inputs of the whole chain and evaluates every operator at once. For
+// example, `[[[rects insetWidth:w height:h nullRect:CGRectNull] alignLeft:x]
+// floor]` has one stage.
+//
+// Signals which were not created by geometry operators are not inspected, and
+// count as zero stages.
+@property (nonatomic, readonly) NSUInteger rcl_stageCount;
+
 @end
+
+// Invokes `block` as a layout transaction.
+//
+// Geometry operators normally send a new value as soon as any of their inputs
+// change. Within a transaction on the main thread, they instead wait until the
+// outermost transaction has finished, then send a single value computed from
+// the latest values of all their inputs. Operators which depend on the results
+// of others are evaluated last, so that they see consistent values.
+//
+// This avoids intermediate values (and redundant layout) when several inputs
+// change at once, or when one change reaches an operator along multiple paths.
+//
+// Transactions may be nested. If this is invoked from a background thread,
+// `block` is simply invoked immediately.
+void RCLPerformLayoutTransaction(void (^block)(void));
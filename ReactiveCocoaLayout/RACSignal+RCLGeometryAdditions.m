@@ -8,75 +8,163 @@
 
 #import "RACSignal+RCLGeometryAdditions.h"
 #import "RACSignal+RCLWritingDirectionAdditions.h"
+#import "RCLGeometryCore.h"
+#import "RCLGeometryKernels.h"
+#import "RCLGeometrySignal.h"
+#import "RCLSignalNaming.h"
 #import <Archimedes/Archimedes.h>
 #import <ReactiveCocoa/ReactiveCocoa.h>
 
-// When any signal sends an NSNumber, sorts the latest values from all of them,
-// and sends either the minimum or the maximum.
-static RACSignal *latestSortedNumber(NSArray *signals, BOOL minimum) {
+// The number of CGFloats which the n-ary operators will gather into a buffer
+// on the stack, before falling back to allocating one on the heap.
+#define RCL_STACK_BUFFER_COUNT 128
+
+// The number of signals at which the n-ary operators switch from fusible
+// operations, which consider every value whenever any one of them changes, to
+// reductions which are updated incrementally.
+static const NSUInteger RCLIncrementalReductionThreshold = 8;
+
+// When any signal sends an NSNumber, finds the minimum or the maximum of the
+// latest values from all of them, and sends it if it changed.
+//
+// Values which are not numbers (such as NSNull) are ignored. If none of the
+// latest values are numbers, nothing is sent.
+static RACSignal *latestExtremeNumber(NSArray *signals, BOOL minimum) {
 	NSCParameterAssert(signals != nil);
 
-	return [[[[RACSignal combineLatest:signals]
-		map:^ id (RACTuple *t) {
-			NSMutableArray *values = [t.allObjects mutableCopy];
+	NSUInteger count = signals.count;
+	if (count == 0) return [RACSignal empty];
 
-			[values removeObject:NSNull.null];
-			if (values.count == 0) return nil;
+	if (count >= RCLIncrementalReductionThreshold) {
+		RCLGeometryReduction reduction = (minimum ? RCLGeometryReductionMinimum : RCLGeometryReductionMaximum);
+		return [[RCLGeometrySignal signalWithOperands:signals reduction:reduction] distinctWithTolerance:0];
+	}
 
-			[values sortUsingSelector:@selector(compare:)];
+	RCLGeometrySignal *signal = [RCLGeometrySignal signalWithOperands:signals operation:^(const RCLGeometry *values) {
+		CGFloat stackBuffer[RCL_STACK_BUFFER_COUNT];
+		CGFloat *numbers = (count <= RCL_STACK_BUFFER_COUNT ? stackBuffer : malloc(sizeof(*numbers) * count));
 
-			if (minimum) {
-				return values[0];
-			} else {
-				return values.lastObject;
-			}
-		}]
-		filter:^ BOOL (NSNumber *value) {
-			return value != nil;
-		}]
-		distinctUntilChanged];
+		size_t numberCount = 0;
+		for (NSUInteger i = 0; i < count; i++) {
+			if (values[i].type != RCLGeometryTypeNumber) continue;
+
+			numbers[numberCount++] = values[i].number;
+		}
+
+		RCLGeometry result = RCLGeometryNone;
+		if (numberCount > 0) {
+			result = RCLGeometryMakeNumber(minimum ? RCLKernelMinimum(numbers, numberCount) : RCLKernelMaximum(numbers, numberCount));
+		}
+
+		if (numbers != stackBuffer) free(numbers);
+		return result;
+	}];
+
+	// A constant only sends one value anyway, so this returns it unchanged.
+	return [signal distinctWithTolerance:0];
 }
 
-// A binary operator accepting two numbers and returning a number.
-typedef CGFloat (^RCLBinaryOperator)(CGFloat, CGFloat);
+// Adds the latest values of the given signals, or subtracts the latest values
+// of all but the first signal from that of the first.
+//
+// The values may be CGFloats, CGSizes, or CGPoints, but all signals must send
+// values of the same type.
+//
+// Returns a signal of results, using the same type as the input values.
+static RACSignal *sumSignals(NSArray *signals, BOOL subtract) {
+	NSCParameterAssert(signals != nil);
+	NSCParameterAssert(signals.count > 0);
 
-// Used from combineSignalsWithOperator() to combine two numbers using an
-// arbitrary binary operator.
-static NSNumber *combineNumbersWithOperator(NSNumber *a, NSNumber *b, RCLBinaryOperator operator) {
-	NSCAssert([a isKindOfClass:NSNumber.class], @"Expected a number, not %@", a);
-	NSCAssert([b isKindOfClass:NSNumber.class], @"Expected a number, not %@", b);
+	NSUInteger count = signals.count;
+
+	if (count >= RCLIncrementalReductionThreshold) {
+		RCLGeometryReduction reduction = (subtract ? RCLGeometryReductionDifference : RCLGeometryReductionSum);
+		return [RCLGeometrySignal signalWithOperands:signals reduction:reduction];
+	}
+
+	return [RCLGeometrySignal signalWithOperands:signals operation:^(const RCLGeometry *values) {
+		RCLGeometry first = values[0];
+		if (count == 1) return first;
+
+		// The components of the values after the first, with all of the first
+		// components followed by all of the second components (if any).
+		NSUInteger restCount = count - 1;
+		CGFloat stackBuffer[RCL_STACK_BUFFER_COUNT];
+		CGFloat *components = (restCount * 2 <= RCL_STACK_BUFFER_COUNT ? stackBuffer : malloc(sizeof(*components) * restCount * 2));
+
+		for (NSUInteger i = 0; i < restCount; i++) {
+			RCLGeometry value = values[i + 1];
+			NSCAssert(value.type == first.type, @"Values do not contain the same type of geometry structure: %@, %@", RCLGeometryBox(first), RCLGeometryBox(value));
+
+			switch (value.type) {
+				case RCLGeometryTypeNumber:
+					components[i] = value.number;
+					break;
+
+				case RCLGeometryTypePoint:
+					components[i] = value.point.x;
+					components[restCount + i] = value.point.y;
+					break;
 
-	return @(operator(a.doubleValue, b.doubleValue));
+				case RCLGeometryTypeSize:
+					components[i] = value.size.width;
+					components[restCount + i] = value.size.height;
+					break;
+
+				default:
+					break;
+			}
+		}
+
+		CGFloat sign = (subtract ? -1 : 1);
+		RCLGeometry result = first;
+
+		switch (first.type) {
+			case RCLGeometryTypeNumber:
+				result.number += sign * RCLKernelSum(components, restCount);
+				break;
+
+			case RCLGeometryTypePoint:
+				result.point.x += sign * RCLKernelSum(components, restCount);
+				result.point.y += sign * RCLKernelSum(components + restCount, restCount);
+				break;
+
+			case RCLGeometryTypeSize:
+				result.size.width += sign * RCLKernelSum(components, restCount);
+				result.size.height += sign * RCLKernelSum(components + restCount, restCount);
+				break;
+
+			default:
+				NSCAssert(NO, @"Values must contain numbers, CGSizes, or CGPoints: %@", RCLGeometryBox(first));
+				result = RCLGeometryNone;
+		}
+
+		if (components != stackBuffer) free(components);
+		return result;
+	}];
 }
 
+// A binary operator accepting two numbers and returning a number.
+typedef CGFloat (^RCLBinaryOperator)(CGFloat, CGFloat);
+
 // Used from combineSignalsWithOperator() to combine two values using an
 // arbitrary binary operator.
-static NSValue *combineValuesWithOperator(NSValue *a, NSValue *b, RCLBinaryOperator operator) {
-	NSCAssert([a isKindOfClass:NSValue.class], @"Expected a value, not %@", a);
-	NSCAssert([b isKindOfClass:NSValue.class], @"Expected a value, not %@", b);
-	NSCAssert(a.med_geometryStructType == b.med_geometryStructType, @"Values do not contain the same type of geometry structure: %@, %@", a, b);
-
-	switch (a.med_geometryStructType) {
-		case MEDGeometryStructTypePoint: {
-			CGPoint pointA = a.med_pointValue;
-			CGPoint pointB = b.med_pointValue;
-
-			CGPoint result = CGPointMake(operator(pointA.x, pointB.x), operator(pointA.y, pointB.y));
-			return MEDBox(result);
-		}
+static RCLGeometry combineGeometryWithOperator(RCLGeometry a, RCLGeometry b, RCLBinaryOperator operator) {
+	NSCAssert(a.type == b.type, @"Values do not contain the same type of geometry structure: %@, %@", RCLGeometryBox(a), RCLGeometryBox(b));
 
-		case MEDGeometryStructTypeSize: {
-			CGSize sizeA = a.med_sizeValue;
-			CGSize sizeB = b.med_sizeValue;
+	switch (a.type) {
+		case RCLGeometryTypeNumber:
+			return RCLGeometryMakeNumber(operator(a.number, b.number));
 
-			CGSize result = CGSizeMake(operator(sizeA.width, sizeB.width), operator(sizeA.height, sizeB.height));
-			return MEDBox(result);
-		}
+		case RCLGeometryTypePoint:
+			return RCLGeometryMakePoint(CGPointMake(operator(a.point.x, b.point.x), operator(a.point.y, b.point.y)));
+
+		case RCLGeometryTypeSize:
+			return RCLGeometryMakeSize(CGSizeMake(operator(a.size.width, b.size.width), operator(a.size.height, b.size.height)));
 
-		case MEDGeometryStructTypeRect:
 		default:
-			NSCAssert(NO, @"Values must contain CGSizes or CGPoints: %@, %@", a, b);
-			return nil;
+			NSCAssert(NO, @"Values must contain numbers, CGSizes, or CGPoints: %@, %@", RCLGeometryBox(a), RCLGeometryBox(b));
+			return RCLGeometryNone;
 	}
 }
 
@@ -92,125 +180,201 @@ static RACSignal *combineSignalsWithOperator(NSArray *signals, RCLBinaryOperator
 	NSCParameterAssert(signals.count > 0);
 	NSCParameterAssert(operator != nil);
 
-	return [[[RACSignal combineLatest:signals]
-		map:^(RACTuple *values) {
-			return values.allObjects.rac_sequence;
-		}]
-		map:^(RACSequence *values) {
-			id result = values.head;
-			BOOL isNumber = [result isKindOfClass:NSNumber.class];
-
-			for (id value in values.tail) {
-				if (isNumber) {
-					result = combineNumbersWithOperator(result, value, operator);
-				} else {
-					result = combineValuesWithOperator(result, value, operator);
-				}
-			}
+	NSUInteger count = signals.count;
 
-			return result;
-		}];
+	return [RCLGeometrySignal signalWithOperands:signals operation:^(const RCLGeometry *values) {
+		RCLGeometry result = values[0];
+
+		for (NSUInteger i = 1; i < count; i++) {
+			result = combineGeometryWithOperator(result, values[i], operator);
+		}
+
+		return result;
+	}];
 }
 
-// Combines the CGRectEdge corresponding to a layout attribute, and the values
-// from the given signals.
+// Passed to the operation of combineAttributeAndSignals() when the layout
+// attribute does not describe one of the edges of a rectangle.
+static const NSInteger RCLNoEdge = -1;
+
+// An operation which combines a CGRectEdge (or RCLNoEdge) with the latest
+// values of some signals.
+typedef RCLGeometry (^RCLEdgeOperation)(NSInteger edge, const RCLGeometry *values);
+
+// Finds the CGRectEdge corresponding to a layout attribute.
 //
-// attribute   - The layout attribute to retrieve the edge for. If the layout
-//				 attribute does not describe one of the edges of a rectangle, no
-//				 `edge` will be provided to the `reduceBlock`. Must not be
-//				 NSLayoutAttributeBaseline.
-// signals	   - The signals to combine the values of. This must contain at
-//				 least one signal.
-// reduceBlock - A block which combines the NSNumber-boxed CGRectEdge (if
-//				 `attribute` corresponds to one), or `nil` (if it does not) and
-//				 the values of each signal in the `signals` array.
+// attribute  - The layout attribute to retrieve the edge for. Must not be
+//              NSLayoutAttributeBaseline.
+// edgeSignal - If `attribute` is NSLayoutAttributeLeading or
+//              NSLayoutAttributeTrailing, this is set to a signal of the edge
+//              for the current writing direction. Otherwise, it's set to nil.
 //
-// Returns a signal of reduced values.
-static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArray *signals, id reduceBlock) {
+// Returns the CGRectEdge that `attribute` describes, or RCLNoEdge if it does
+// not describe one of the edges of a rectangle, or if `edgeSignal` was set.
+static NSInteger edgeForAttribute(NSLayoutAttribute attribute, RACSignal **edgeSignal) {
 	NSCParameterAssert(attribute != NSLayoutAttributeBaseline);
 	NSCParameterAssert(attribute != NSLayoutAttributeNotAnAttribute);
-	NSCParameterAssert(signals.count > 0);
+	NSCParameterAssert(edgeSignal != NULL);
 
-	RACSignal *edgeSignal = nil;
-	NSMutableArray *mutableSignals = [signals mutableCopy];
+	*edgeSignal = nil;
 
 	switch (attribute) {
 		// TODO: Consider modified view coordinate systems?
 		case NSLayoutAttributeLeft:
-			edgeSignal = [RACSignal return:@(CGRectMinXEdge)];
-			break;
+			return CGRectMinXEdge;
 
 		case NSLayoutAttributeRight:
-			edgeSignal = [RACSignal return:@(CGRectMaxXEdge)];
-			break;
+			return CGRectMaxXEdge;
 
 	#ifdef RCL_FOR_IPHONE
 		case NSLayoutAttributeTop:
-			edgeSignal = [RACSignal return:@(CGRectMinYEdge)];
-			break;
+			return CGRectMinYEdge;
 
 		case NSLayoutAttributeBottom:
-			edgeSignal = [RACSignal return:@(CGRectMaxYEdge)];
-			break;
+			return CGRectMaxYEdge;
 	#else
 		case NSLayoutAttributeTop:
-			edgeSignal = [RACSignal return:@(CGRectMaxYEdge)];
-			break;
+			return CGRectMaxYEdge;
 
 		case NSLayoutAttributeBottom:
-			edgeSignal = [RACSignal return:@(CGRectMinYEdge)];
-			break;
+			return CGRectMinYEdge;
 	#endif
 
 		case NSLayoutAttributeLeading:
-		case NSLayoutAttributeTrailing: {
-			RACReplaySubject *edgeSubject = [RACReplaySubject replaySubjectWithCapacity:1];
-
-			RACSignal *baseSignal = (attribute == NSLayoutAttributeLeading ? RACSignal.leadingEdgeSignal : RACSignal.trailingEdgeSignal);
-			edgeSignal = [[baseSignal multicast:edgeSubject] autoconnect];
+			*edgeSignal = RACSignal.leadingEdgeSignal;
+			return RCLNoEdge;
 
-			// Terminate edgeSubject when one of the given signals completes
-			// (doesn't really matter which one).
-			mutableSignals[0] = [mutableSignals[0] doCompleted:^{
-				[edgeSubject sendCompleted];
-			}];
-
-			break;
-		}
+		case NSLayoutAttributeTrailing:
+			*edgeSignal = RACSignal.trailingEdgeSignal;
+			return RCLNoEdge;
 
 		case NSLayoutAttributeWidth:
 		case NSLayoutAttributeHeight:
 		case NSLayoutAttributeCenterX:
 		case NSLayoutAttributeCenterY:
 			// No sensical edge for these attributes.
-			edgeSignal = [RACSignal return:nil];
-			break;
+			return RCLNoEdge;
 
 		default:
 			NSCAssert(NO, @"Unrecognized NSLayoutAttribute: %li", (long)attribute);
-			return nil;
+			return RCLNoEdge;
+	}
+}
+
+// Combines the CGRectEdge corresponding to a layout attribute, and the values
+// from the given signals.
+//
+// attribute - The layout attribute to retrieve the edge for. If the layout
+//             attribute does not describe one of the edges of a rectangle,
+//             RCLNoEdge will be provided to the `operation`. Must not be
+//             NSLayoutAttributeBaseline.
+// signals   - The signals to combine the values of. This must contain at
+//             least one signal.
+// operation - A block which combines the CGRectEdge (if `attribute`
+//             corresponds to one), or RCLNoEdge (if it does not) and the
+//             latest values of each signal in the `signals` array.
+//
+// Returns a signal of combined values.
+static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArray *signals, RCLEdgeOperation operation) {
+	NSCParameterAssert(signals.count > 0);
+	NSCParameterAssert(operation != nil);
+
+	RACSignal *edgeSignal = nil;
+	NSInteger edge = edgeForAttribute(attribute, &edgeSignal);
+
+	if (edgeSignal != nil) {
+		// The edge signal never completes, so don't wait for it.
+		return [RCLGeometrySignal signalWithOperands:signals auxiliaryOperands:@[ edgeSignal ] operation:^(const RCLGeometry *values) {
+			return operation((NSInteger)values[0].number, values + 1);
+		}];
 	}
 
-	[mutableSignals insertObject:edgeSignal atIndex:0];
-	return [RACSignal combineLatest:mutableSignals reduce:reduceBlock];
+	return [RCLGeometrySignal signalWithOperands:signals operation:^(const RCLGeometry *values) {
+		return operation(edge, values);
+	}];
+}
+
+// An operation which combines a CGRectEdge (or RCLNoEdge) with the latest
+// values of some signals, and computes several results from them.
+typedef void (^RCLEdgeMultipleOperation)(NSInteger edge, const RCLGeometry *values, RCLGeometry *results);
+
+// Like combineAttributeAndSignals(), but computes several results, which are
+// shared between the returned signals.
+//
+// count - The number of results computed by `operation`. This must not be
+//         zero.
+//
+// Returns an array of `count` signals, each of which sends the result at the
+// same index. See +[RCLGeometrySignal signalsWithOperands:auxiliaryOperands:count:operation:].
+static NSArray *multiplexAttributeAndSignals(NSLayoutAttribute attribute, NSArray *signals, NSUInteger count, RCLEdgeMultipleOperation operation) {
+	NSCParameterAssert(signals.count > 0);
+	NSCParameterAssert(operation != nil);
+
+	RACSignal *edgeSignal = nil;
+	NSInteger edge = edgeForAttribute(attribute, &edgeSignal);
+
+	if (edgeSignal != nil) {
+		return [RCLGeometrySignal signalsWithOperands:signals auxiliaryOperands:@[ edgeSignal ] count:count operation:^(const RCLGeometry *values, RCLGeometry *results) {
+			operation((NSInteger)values[0].number, values + 1, results);
+		}];
+	}
+
+	return [RCLGeometrySignal signalsWithOperands:signals auxiliaryOperands:@[] count:count operation:^(const RCLGeometry *values, RCLGeometry *results) {
+		operation(edge, values, results);
+	}];
+}
+
+// Divides a rect for -divideWithAmount:padding:fromEdge: and the operators
+// built upon it.
+//
+// edge      - The edge to divide from. This must not be RCLNoEdge.
+// values    - The latest amount, padding, and rect, in that order.
+// slice     - Set to the slice of the rect.
+// remainder - Set to the remainder of the rect, after the slice and padding.
+static void divideRectValues(NSInteger edge, const RCLGeometry *values, CGRect *slice, CGRect *remainder) {
+	NSCAssert(edge != RCLNoEdge, @"NSLayoutAttribute does not represent an edge");
+	NSCAssert(values[0].type == RCLGeometryTypeNumber, @"Slice amount is not a number: %@", RCLGeometryBox(values[0]));
+	NSCAssert(values[1].type == RCLGeometryTypeNumber, @"Padding is not a number: %@", RCLGeometryBox(values[1]));
+	NSCAssert(values[2].type == RCLGeometryTypeRect, @"Value to divide is not a CGRect: %@", RCLGeometryBox(values[2]));
+
+	RCLRectDivideWithPadding(values[2].rect, slice, remainder, values[0].number, values[1].number, (RCLRectEdge)edge);
+}
+
+// Insets a rect, using `nullRect` if the insets would result in a null
+// rectangle.
+static RCLGeometry insetRect(CGRect rect, MEDEdgeInsets insets, CGRect nullRect) {
+	RCLEdgeInsets edgeInsets = RCLEdgeInsetsMake(insets.top, insets.left, insets.bottom, insets.right);
+
+	#ifdef RCL_FOR_IPHONE
+		return RCLGeometryMakeRect(RCLRectInset(rect, edgeInsets, true, nullRect));
+	#else
+		return RCLGeometryMakeRect(RCLRectInset(rect, edgeInsets, false, nullRect));
+	#endif
 }
 
 @implementation RACSignal (RCLGeometryAdditions)
 
++ (RACSignal *)constant:(id)value {
+	RCLGeometry geometry = RCLGeometryFromObject(value);
+	if (geometry.type == RCLGeometryTypeNone) return [RACSignal return:value];
+
+	return [RCLGeometrySignal signalWithConstant:geometry object:value];
+}
+
 + (RACSignal *)zero {
-	return [RACSignal return:@0];
+	return [RACSignal constant:@0];
 }
 
 + (RACSignal *)zeroRect {
-	return [RACSignal return:[NSValue med_valueWithRect:CGRectZero]];
+	return [RACSignal constant:[NSValue med_valueWithRect:CGRectZero]];
 }
 
 + (RACSignal *)zeroSize {
-	return [RACSignal return:[NSValue med_valueWithSize:CGSizeZero]];
+	return [RACSignal constant:[NSValue med_valueWithSize:CGSizeZero]];
 }
 
 + (RACSignal *)zeroPoint {
-	return [RACSignal return:[NSValue med_valueWithPoint:CGPointZero]];
+	return [RACSignal constant:[NSValue med_valueWithPoint:CGPointZero]];
 }
 
 + (RACSignal *)rectsWithX:(RACSignal *)xSignal Y:(RACSignal *)ySignal width:(RACSignal *)widthSignal height:(RACSignal *)heightSignal {
@@ -219,276 +383,313 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 	NSParameterAssert(widthSignal != nil);
 	NSParameterAssert(heightSignal != nil);
 
-	return [[RACSignal combineLatest:@[ xSignal, ySignal, widthSignal, heightSignal ] reduce:^(NSNumber *x, NSNumber *y, NSNumber *width, NSNumber *height) {
-		NSAssert([x isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", xSignal, x);
-		NSAssert([y isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", ySignal, y);
-		NSAssert([width isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", widthSignal, width);
-		NSAssert([height isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", heightSignal, height);
+	return [[RCLGeometrySignal signalWithOperands:@[ xSignal, ySignal, widthSignal, heightSignal ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry x = values[0], y = values[1], width = values[2], height = values[3];
 
-		return MEDBox(CGRectMake(x.doubleValue, y.doubleValue, width.doubleValue, height.doubleValue));
-	}] setNameWithFormat:@"+rectsWithX: %@ Y: %@ width: %@ height: %@", xSignal, ySignal, widthSignal, heightSignal];
+		NSAssert(x.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", xSignal, RCLGeometryBox(x));
+		NSAssert(y.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", ySignal, RCLGeometryBox(y));
+		NSAssert(width.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", widthSignal, RCLGeometryBox(width));
+		NSAssert(height.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", heightSignal, RCLGeometryBox(height));
+
+		return RCLGeometryMakeRect(CGRectMake(x.number, y.number, width.number, height.number));
+	}] rcl_setNameWithBlock:RCLName(@"+rectsWithX: %@ Y: %@ width: %@ height: %@", xSignal, ySignal, widthSignal, heightSignal)];
 }
 
 + (RACSignal *)rectsWithOrigin:(RACSignal *)originSignal size:(RACSignal *)sizeSignal {
 	NSParameterAssert(originSignal != nil);
 	NSParameterAssert(sizeSignal != nil);
 
-	return [[RACSignal combineLatest:@[ originSignal, sizeSignal ] reduce:^(NSValue *origin, NSValue *size) {
-		NSAssert([origin isKindOfClass:NSValue.class] && origin.med_geometryStructType == MEDGeometryStructTypePoint, @"Value sent by %@ is not a CGPoint: %@", originSignal, origin);
-		NSAssert([size isKindOfClass:NSValue.class] && size.med_geometryStructType == MEDGeometryStructTypeSize, @"Value sent by %@ is not a CGSize: %@", sizeSignal, size);
+	return [[RCLGeometrySignal signalWithOperands:@[ originSignal, sizeSignal ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry origin = values[0], size = values[1];
 
-		CGPoint p = origin.med_pointValue;
-		CGSize s = size.med_sizeValue;
+		NSAssert(origin.type == RCLGeometryTypePoint, @"Value sent by %@ is not a CGPoint: %@", originSignal, RCLGeometryBox(origin));
+		NSAssert(size.type == RCLGeometryTypeSize, @"Value sent by %@ is not a CGSize: %@", sizeSignal, RCLGeometryBox(size));
 
-		return MEDBox(CGRectMake(p.x, p.y, s.width, s.height));
-	}] setNameWithFormat:@"+rectsWithOrigin: %@ size: %@", originSignal, sizeSignal];
+		return RCLGeometryMakeRect(CGRectMake(origin.point.x, origin.point.y, size.size.width, size.size.height));
+	}] rcl_setNameWithBlock:RCLName(@"+rectsWithOrigin: %@ size: %@", originSignal, sizeSignal)];
 }
 
 + (RACSignal *)rectsWithCenter:(RACSignal *)centerSignal size:(RACSignal *)sizeSignal {
 	NSParameterAssert(centerSignal != nil);
 	NSParameterAssert(sizeSignal != nil);
 
-	return [[RACSignal combineLatest:@[ centerSignal, sizeSignal ] reduce:^(NSValue *center, NSValue *size) {
-		NSAssert([center isKindOfClass:NSValue.class] && center.med_geometryStructType == MEDGeometryStructTypePoint, @"Value sent by %@ is not a CGPoint: %@", centerSignal, center);
-		NSAssert([size isKindOfClass:NSValue.class] && size.med_geometryStructType == MEDGeometryStructTypeSize, @"Value sent by %@ is not a CGSize: %@", sizeSignal, size);
+	return [[RCLGeometrySignal signalWithOperands:@[ centerSignal, sizeSignal ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry center = values[0], size = values[1];
+
+		NSAssert(center.type == RCLGeometryTypePoint, @"Value sent by %@ is not a CGPoint: %@", centerSignal, RCLGeometryBox(center));
+		NSAssert(size.type == RCLGeometryTypeSize, @"Value sent by %@ is not a CGSize: %@", sizeSignal, RCLGeometryBox(size));
 
-		CGPoint p = center.med_pointValue;
-		CGSize s = size.med_sizeValue;
+		CGPoint p = center.point;
+		CGSize s = size.size;
 
-		return MEDBox(CGRectMake(p.x - s.width / 2, p.y - s.height / 2, s.width, s.height));
-	}] setNameWithFormat:@"+rectsWithCenter: %@ size: %@", centerSignal, sizeSignal];
+		return RCLGeometryMakeRect(CGRectMake(p.x - s.width / 2, p.y - s.height / 2, s.width, s.height));
+	}] rcl_setNameWithBlock:RCLName(@"+rectsWithCenter: %@ size: %@", centerSignal, sizeSignal)];
 }
 
 + (RACSignal *)rectsWithSize:(RACSignal *)sizeSignal {
-	return [[self rectsWithOrigin:self.zeroPoint size:sizeSignal] setNameWithFormat:@"+rectsWithSize: %@", sizeSignal];
+	return [[self rectsWithOrigin:self.zeroPoint size:sizeSignal] rcl_setNameWithBlock:RCLName(@"+rectsWithSize: %@", sizeSignal)];
 }
 
 - (RACSignal *)size {
-	return [[self map:^(NSValue *value) {
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, value);
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		NSAssert(values[0].type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(values[0]));
 
-		return MEDBox(value.med_rectValue.size);
-	}] setNameWithFormat:@"[%@] -size", self.name];
+		return RCLGeometryMakeSize(values[0].rect.size);
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -size", self.name)];
 }
 
 - (RACSignal *)replaceSize:(RACSignal *)sizeSignal {
-	return [[self.class rectsWithOrigin:self.origin size:sizeSignal] setNameWithFormat:@"[%@] -replaceSize: %@", self.name, sizeSignal];
+	NSParameterAssert(sizeSignal != nil);
+
+	// Equivalent to combining -origin with `sizeSignal`, without the
+	// intermediate CGPoint.
+	return [[RCLGeometrySignal signalWithOperands:@[ self, sizeSignal ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry rect = values[0], size = values[1];
+
+		NSAssert(rect.type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(rect));
+		NSAssert(size.type == RCLGeometryTypeSize, @"Value sent by %@ is not a CGSize: %@", sizeSignal, RCLGeometryBox(size));
+
+		rect.rect.size = size.size;
+		return rect;
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -replaceSize: %@", self.name, sizeSignal)];
 }
 
 + (RACSignal *)sizesWithWidth:(RACSignal *)widthSignal height:(RACSignal *)heightSignal {
 	NSParameterAssert(widthSignal != nil);
 	NSParameterAssert(heightSignal != nil);
 
-	return [[RACSignal combineLatest:@[ widthSignal, heightSignal ] reduce:^(NSNumber *width, NSNumber *height) {
-		NSAssert([width isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", widthSignal, width);
-		NSAssert([height isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", heightSignal, height);
+	return [[RCLGeometrySignal signalWithOperands:@[ widthSignal, heightSignal ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry width = values[0], height = values[1];
 
-		return MEDBox(CGSizeMake(width.doubleValue, height.doubleValue));
-	}] setNameWithFormat:@"+sizesWithWidth: %@ height: %@", widthSignal, heightSignal];
+		NSAssert(width.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", widthSignal, RCLGeometryBox(width));
+		NSAssert(height.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", heightSignal, RCLGeometryBox(height));
+
+		return RCLGeometryMakeSize(CGSizeMake(width.number, height.number));
+	}] rcl_setNameWithBlock:RCLName(@"+sizesWithWidth: %@ height: %@", widthSignal, heightSignal)];
 }
 
 - (RACSignal *)width {
-	return [[self map:^(NSValue *value) {
-		if (value.med_geometryStructType == MEDGeometryStructTypeRect) {
-			return @(CGRectGetWidth(value.med_rectValue));
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry value = values[0];
+
+		if (value.type == RCLGeometryTypeRect) {
+			return RCLGeometryMakeNumber(CGRectGetWidth(value.rect));
 		} else {
-			NSAssert(value.med_geometryStructType == MEDGeometryStructTypeSize, @"Unexpected type of value: %@", value);
-			return @(value.med_sizeValue.width);
+			NSAssert(value.type == RCLGeometryTypeSize, @"Unexpected type of value: %@", RCLGeometryBox(value));
+			return RCLGeometryMakeNumber(value.size.width);
 		}
-	}] setNameWithFormat:@"[%@] -width", self.name];
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -width", self.name)];
 }
 
 - (RACSignal *)replaceWidth:(RACSignal *)widthSignal {
 	NSParameterAssert(widthSignal != nil);
 
-	return [[RACSignal combineLatest:@[ widthSignal, self ] reduce:^(NSNumber *width, NSValue *value) {
-		if (value.med_geometryStructType == MEDGeometryStructTypeRect) {
-			CGRect rect = value.med_rectValue;
-			rect.size.width = width.doubleValue;
-			return MEDBox(rect);
-		} else {
-			NSAssert(value.med_geometryStructType == MEDGeometryStructTypeSize, @"Unexpected type of value: %@", value);
+	return [[RCLGeometrySignal signalWithOperands:@[ widthSignal, self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry width = values[0], value = values[1];
 
-			CGSize size = value.med_sizeValue;
-			size.width = width.doubleValue;
-			return MEDBox(size);
+		if (value.type == RCLGeometryTypeRect) {
+			value.rect.size.width = width.number;
+		} else {
+			NSAssert(value.type == RCLGeometryTypeSize, @"Unexpected type of value: %@", RCLGeometryBox(value));
+			value.size.width = width.number;
 		}
-	}] setNameWithFormat:@"[%@] -replaceWidth: %@", self.name, widthSignal];
+
+		return value;
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -replaceWidth: %@", self.name, widthSignal)];
 }
 
 - (RACSignal *)height {
-	return [[self map:^(NSValue *value) {
-		if (value.med_geometryStructType == MEDGeometryStructTypeRect) {
-			return @(CGRectGetHeight(value.med_rectValue));
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry value = values[0];
+
+		if (value.type == RCLGeometryTypeRect) {
+			return RCLGeometryMakeNumber(CGRectGetHeight(value.rect));
 		} else {
-			NSAssert(value.med_geometryStructType == MEDGeometryStructTypeSize, @"Unexpected type of value: %@", value);
-			return @(value.med_sizeValue.height);
+			NSAssert(value.type == RCLGeometryTypeSize, @"Unexpected type of value: %@", RCLGeometryBox(value));
+			return RCLGeometryMakeNumber(value.size.height);
 		}
-	}] setNameWithFormat:@"[%@] -height", self.name];
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -height", self.name)];
 }
 
 - (RACSignal *)replaceHeight:(RACSignal *)heightSignal {
 	NSParameterAssert(heightSignal != nil);
 
-	return [[RACSignal combineLatest:@[ heightSignal, self ] reduce:^(NSNumber *height, NSValue *value) {
-		if (value.med_geometryStructType == MEDGeometryStructTypeRect) {
-			CGRect rect = value.med_rectValue;
-			rect.size.height = height.doubleValue;
-			return MEDBox(rect);
-		} else {
-			NSAssert(value.med_geometryStructType == MEDGeometryStructTypeSize, @"Unexpected type of value: %@", value);
+	return [[RCLGeometrySignal signalWithOperands:@[ heightSignal, self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry height = values[0], value = values[1];
 
-			CGSize size = value.med_sizeValue;
-			size.height = height.doubleValue;
-			return MEDBox(size);
+		if (value.type == RCLGeometryTypeRect) {
+			value.rect.size.height = height.number;
+		} else {
+			NSAssert(value.type == RCLGeometryTypeSize, @"Unexpected type of value: %@", RCLGeometryBox(value));
+			value.size.height = height.number;
 		}
-	}] setNameWithFormat:@"[%@] -replaceHeight: %@", self.name, heightSignal];
+
+		return value;
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -replaceHeight: %@", self.name, heightSignal)];
 }
 
 - (RACSignal *)origin {
-	return [[self map:^(NSValue *value) {
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, value);
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		NSAssert(values[0].type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(values[0]));
 
-		return MEDBox(value.med_rectValue.origin);
-	}] setNameWithFormat:@"[%@] -origin", self.name];
+		return RCLGeometryMakePoint(values[0].rect.origin);
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -origin", self.name)];
 }
 
 - (RACSignal *)replaceOrigin:(RACSignal *)originSignal {
-	return [[self.class rectsWithOrigin:originSignal size:self.size] setNameWithFormat:@"[%@] -replaceOrigin: %@", self.name, originSignal];
+	NSParameterAssert(originSignal != nil);
+
+	// Equivalent to combining `originSignal` with -size, without the
+	// intermediate CGSize.
+	return [[RCLGeometrySignal signalWithOperands:@[ originSignal, self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry origin = values[0], rect = values[1];
+
+		NSAssert(origin.type == RCLGeometryTypePoint, @"Value sent by %@ is not a CGPoint: %@", originSignal, RCLGeometryBox(origin));
+		NSAssert(rect.type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(rect));
+
+		rect.rect.origin = origin.point;
+		return rect;
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -replaceOrigin: %@", self.name, originSignal)];
 }
 
 - (RACSignal *)center {
-	return [[self map:^(NSValue *value) {
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, value);
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		NSAssert(values[0].type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(values[0]));
 
-		return MEDBox(MEDRectCenterPoint(value.med_rectValue));
-	}] setNameWithFormat:@"[%@] -center", self.name];
+		return RCLGeometryMakePoint(MEDRectCenterPoint(values[0].rect));
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -center", self.name)];
 }
 
 + (RACSignal *)pointsWithX:(RACSignal *)xSignal Y:(RACSignal *)ySignal {
 	NSParameterAssert(xSignal != nil);
 	NSParameterAssert(ySignal != nil);
 
-	return [[RACSignal combineLatest:@[ xSignal, ySignal ] reduce:^(NSNumber *x, NSNumber *y) {
-		NSAssert([x isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", xSignal, x);
-		NSAssert([y isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", ySignal, y);
+	return [[RCLGeometrySignal signalWithOperands:@[ xSignal, ySignal ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry x = values[0], y = values[1];
 
-		return MEDBox(CGPointMake(x.doubleValue, y.doubleValue));
-	}] setNameWithFormat:@"+pointsWithX: %@ Y: %@", xSignal, ySignal];
+		NSAssert(x.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", xSignal, RCLGeometryBox(x));
+		NSAssert(y.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", ySignal, RCLGeometryBox(y));
+
+		return RCLGeometryMakePoint(CGPointMake(x.number, y.number));
+	}] rcl_setNameWithBlock:RCLName(@"+pointsWithX: %@ Y: %@", xSignal, ySignal)];
 }
 
 - (RACSignal *)x {
-	return [[self map:^(NSValue *value) {
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypePoint, @"Value sent by %@ is not a CGPoint: %@", self, value);
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		NSAssert(values[0].type == RCLGeometryTypePoint, @"Value sent by %@ is not a CGPoint: %@", self, RCLGeometryBox(values[0]));
 
-		return @(value.med_pointValue.x);
-	}] setNameWithFormat:@"[%@] -x", self.name];
-} 
+		return RCLGeometryMakeNumber(values[0].point.x);
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -x", self.name)];
+}
 
 - (RACSignal *)replaceX:(RACSignal *)xSignal {
-	return [[self.class pointsWithX:xSignal Y:self.y] setNameWithFormat:@"[%@] -replaceX: %@", self.name, xSignal];
+	NSParameterAssert(xSignal != nil);
+
+	return [[RCLGeometrySignal signalWithOperands:@[ xSignal, self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry x = values[0], point = values[1];
+
+		NSAssert(x.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", xSignal, RCLGeometryBox(x));
+		NSAssert(point.type == RCLGeometryTypePoint, @"Value sent by %@ is not a CGPoint: %@", self, RCLGeometryBox(point));
+
+		point.point.x = x.number;
+		return point;
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -replaceX: %@", self.name, xSignal)];
 }
 
 - (RACSignal *)y {
-	return [[self map:^(NSValue *value) {
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypePoint, @"Value sent by %@ is not a CGPoint: %@", self, value);
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		NSAssert(values[0].type == RCLGeometryTypePoint, @"Value sent by %@ is not a CGPoint: %@", self, RCLGeometryBox(values[0]));
 
-		return @(value.med_pointValue.y);
-	}] setNameWithFormat:@"[%@] -y", self.name];
+		return RCLGeometryMakeNumber(values[0].point.y);
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -y", self.name)];
 }
 
 - (RACSignal *)replaceY:(RACSignal *)ySignal {
-	return [[self.class pointsWithX:self.x Y:ySignal] setNameWithFormat:@"[%@] -replaceY: %@", self.name, ySignal];
+	NSParameterAssert(ySignal != nil);
+
+	return [[RCLGeometrySignal signalWithOperands:@[ self, ySignal ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry point = values[0], y = values[1];
+
+		NSAssert(point.type == RCLGeometryTypePoint, @"Value sent by %@ is not a CGPoint: %@", self, RCLGeometryBox(point));
+		NSAssert(y.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", ySignal, RCLGeometryBox(y));
+
+		point.point.y = y.number;
+		return point;
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -replaceY: %@", self.name, ySignal)];
 }
 
 - (RACSignal *)valueForAttribute:(NSLayoutAttribute)attribute {
-	return [combineAttributeAndSignals(attribute, @[ self ], ^ id (NSNumber *edge, NSValue *value) {
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, value);
+	return [combineAttributeAndSignals(attribute, @[ self ], ^ RCLGeometry (NSInteger edge, const RCLGeometry *values) {
+		NSAssert(values[0].type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(values[0]));
 
-		CGRect rect = value.med_rectValue;
-		if (edge == nil) {
+		CGRect rect = values[0].rect;
+		if (edge == RCLNoEdge) {
 			switch (attribute) {
 				case NSLayoutAttributeWidth:
-					return @(CGRectGetWidth(rect));
+					return RCLGeometryMakeNumber(CGRectGetWidth(rect));
 
 				case NSLayoutAttributeHeight:
-					return @(CGRectGetHeight(rect));
+					return RCLGeometryMakeNumber(CGRectGetHeight(rect));
 
 				case NSLayoutAttributeCenterX:
-					return @(CGRectGetMidX(rect));
+					return RCLGeometryMakeNumber(CGRectGetMidX(rect));
 
 				case NSLayoutAttributeCenterY:
-					return @(CGRectGetMidY(rect));
+					return RCLGeometryMakeNumber(CGRectGetMidY(rect));
 
 				default:
 					NSAssert(NO, @"NSLayoutAttribute should have had a CGRectEdge: %li", (long)attribute);
-					return nil;
+					return RCLGeometryNone;
 			}
 		} else {
-			switch (edge.unsignedIntegerValue) {
-				case CGRectMinXEdge:
-					return @(CGRectGetMinX(rect));
-
-				case CGRectMaxXEdge:
-					return @(CGRectGetMaxX(rect));
-
-				case CGRectMinYEdge:
-					return @(CGRectGetMinY(rect));
-
-				case CGRectMaxYEdge:
-					return @(CGRectGetMaxY(rect));
-
-				default:
-					NSAssert(NO, @"Unrecognized CGRectEdge: %@", edge);
-					return nil;
-			}
+			return RCLGeometryMakeNumber(RCLRectGetEdge(rect, (RCLRectEdge)edge));
 		}
-	}) setNameWithFormat:@"[%@] -valueForAttribute: %li", self.name, (long)attribute];
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -valueForAttribute: %li", self.name, (long)attribute)];
 }
 
 - (RACSignal *)left {
-	return [[self valueForAttribute:NSLayoutAttributeLeft] setNameWithFormat:@"[%@] -left", self.name];
+	return [[self valueForAttribute:NSLayoutAttributeLeft] rcl_setNameWithBlock:RCLName(@"[%@] -left", self.name)];
 }
 
 - (RACSignal *)right {
-	return [[self valueForAttribute:NSLayoutAttributeRight] setNameWithFormat:@"[%@] -right", self.name];
+	return [[self valueForAttribute:NSLayoutAttributeRight] rcl_setNameWithBlock:RCLName(@"[%@] -right", self.name)];
 }
 
 - (RACSignal *)top {
-	return [[self valueForAttribute:NSLayoutAttributeTop] setNameWithFormat:@"[%@] -top", self.name];
+	return [[self valueForAttribute:NSLayoutAttributeTop] rcl_setNameWithBlock:RCLName(@"[%@] -top", self.name)];
 }
 
 - (RACSignal *)bottom {
-	return [[self valueForAttribute:NSLayoutAttributeBottom] setNameWithFormat:@"[%@] -bottom", self.name];
+	return [[self valueForAttribute:NSLayoutAttributeBottom] rcl_setNameWithBlock:RCLName(@"[%@] -bottom", self.name)];
 }
 
 - (RACSignal *)leading {
-	return [[self valueForAttribute:NSLayoutAttributeLeading] setNameWithFormat:@"[%@] -leading", self.name];
+	return [[self valueForAttribute:NSLayoutAttributeLeading] rcl_setNameWithBlock:RCLName(@"[%@] -leading", self.name)];
 }
 
 - (RACSignal *)trailing {
-	return [[self valueForAttribute:NSLayoutAttributeTrailing] setNameWithFormat:@"[%@] -trailing", self.name];
+	return [[self valueForAttribute:NSLayoutAttributeTrailing] rcl_setNameWithBlock:RCLName(@"[%@] -trailing", self.name)];
 }
 
 - (RACSignal *)centerX {
-	return [[self valueForAttribute:NSLayoutAttributeCenterX] setNameWithFormat:@"[%@] -centerX", self.name];
+	return [[self valueForAttribute:NSLayoutAttributeCenterX] rcl_setNameWithBlock:RCLName(@"[%@] -centerX", self.name)];
 }
 
 - (RACSignal *)centerY {
-	return [[self valueForAttribute:NSLayoutAttributeCenterY] setNameWithFormat:@"[%@] -centerY", self.name];
+	return [[self valueForAttribute:NSLayoutAttributeCenterY] rcl_setNameWithBlock:RCLName(@"[%@] -centerY", self.name)];
 }
 
 - (RACSignal *)alignAttribute:(NSLayoutAttribute)attribute to:(RACSignal *)valueSignal {
 	NSParameterAssert(valueSignal != nil);
 
-	return [combineAttributeAndSignals(attribute, @[ valueSignal, self ], ^ id (NSNumber *edge, NSNumber *num, NSValue *value) {
-		NSAssert([num isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", valueSignal, num);
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, value);
+	return [combineAttributeAndSignals(attribute, @[ valueSignal, self ], ^ RCLGeometry (NSInteger edge, const RCLGeometry *values) {
+		NSAssert(values[0].type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", valueSignal, RCLGeometryBox(values[0]));
+		NSAssert(values[1].type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(values[1]));
 
-		CGFloat n = num.doubleValue;
-		CGRect rect = value.med_rectValue;
+		CGFloat n = values[0].number;
+		CGRect rect = values[1].rect;
 
-		if (edge == nil) {
+		if (edge == RCLNoEdge) {
 			switch (attribute) {
 				case NSLayoutAttributeWidth:
 					rect.size.width = n;
@@ -508,89 +709,71 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 
 				default:
 					NSAssert(NO, @"NSLayoutAttribute should have had a CGRectEdge: %li", (long)attribute);
-					return nil;
+					return RCLGeometryNone;
 			}
 		} else {
-			switch (edge.unsignedIntegerValue) {
-				case CGRectMinXEdge:
-					rect.origin.x = n;
-					break;
-
-				case CGRectMinYEdge:
-					rect.origin.y = n;
-					break;
-
-				case CGRectMaxXEdge:
-					rect.origin.x = n - CGRectGetWidth(rect);
-					break;
-
-				case CGRectMaxYEdge:
-					rect.origin.y = n - CGRectGetHeight(rect);
-					break;
-
-				default:
-					NSAssert(NO, @"Unrecognized CGRectEdge: %@", edge);
-					return nil;
-			}
+			return RCLGeometryMakeRect(RCLRectAlignEdge(rect, (RCLRectEdge)edge, n));
 		}
 
-		return MEDBox(CGRectStandardize(rect));
-	}) setNameWithFormat:@"[%@] -alignAttribute: %li to: %@", self.name, (long)attribute, valueSignal];
+		return RCLGeometryMakeRect(CGRectStandardize(rect));
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -alignAttribute: %li to: %@", self.name, (long)attribute, valueSignal)];
 }
 
 - (RACSignal *)alignCenter:(RACSignal *)centerSignal {
 	NSParameterAssert(centerSignal != nil);
 
-	return [[RACSignal combineLatest:@[ centerSignal, self ] reduce:^(NSValue *center, NSValue *value) {
-		NSAssert([center isKindOfClass:NSValue.class] && center.med_geometryStructType == MEDGeometryStructTypePoint, @"Value sent by %@ is not a CGPoint: %@", centerSignal, center);
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, value);
+	return [[RCLGeometrySignal signalWithOperands:@[ centerSignal, self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry center = values[0], value = values[1];
 
-		CGFloat x = center.med_pointValue.x;
-		CGFloat y = center.med_pointValue.y;
+		NSAssert(center.type == RCLGeometryTypePoint, @"Value sent by %@ is not a CGPoint: %@", centerSignal, RCLGeometryBox(center));
+		NSAssert(value.type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(value));
 
-		CGRect rect = value.med_rectValue;
-		return MEDBox(CGRectMake(x - CGRectGetWidth(rect) / 2, y - CGRectGetHeight(rect) / 2, CGRectGetWidth(rect), CGRectGetHeight(rect)));
-	}] setNameWithFormat:@"[%@] -alignCenter: %@", self.name, centerSignal];
+		CGFloat x = center.point.x;
+		CGFloat y = center.point.y;
+
+		CGRect rect = value.rect;
+		return RCLGeometryMakeRect(CGRectMake(x - CGRectGetWidth(rect) / 2, y - CGRectGetHeight(rect) / 2, CGRectGetWidth(rect), CGRectGetHeight(rect)));
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -alignCenter: %@", self.name, centerSignal)];
 }
 
 - (RACSignal *)alignLeft:(RACSignal *)positionSignal {
-	return [[self alignAttribute:NSLayoutAttributeLeft to:positionSignal] setNameWithFormat:@"[%@] -alignLeft: %@", self.name, positionSignal];
+	return [[self alignAttribute:NSLayoutAttributeLeft to:positionSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignLeft: %@", self.name, positionSignal)];
 }
 
 - (RACSignal *)alignRight:(RACSignal *)positionSignal {
-	return [[self alignAttribute:NSLayoutAttributeRight to:positionSignal] setNameWithFormat:@"[%@] -alignRight: %@", self.name, positionSignal];
+	return [[self alignAttribute:NSLayoutAttributeRight to:positionSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignRight: %@", self.name, positionSignal)];
 }
 
 - (RACSignal *)alignTop:(RACSignal *)positionSignal {
-	return [[self alignAttribute:NSLayoutAttributeTop to:positionSignal] setNameWithFormat:@"[%@] -alignTop: %@", self.name, positionSignal];
+	return [[self alignAttribute:NSLayoutAttributeTop to:positionSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignTop: %@", self.name, positionSignal)];
 }
 
 - (RACSignal *)alignBottom:(RACSignal *)positionSignal {
-	return [[self alignAttribute:NSLayoutAttributeBottom to:positionSignal] setNameWithFormat:@"[%@] -alignBottom: %@", self.name, positionSignal];
+	return [[self alignAttribute:NSLayoutAttributeBottom to:positionSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignBottom: %@", self.name, positionSignal)];
 }
 
 - (RACSignal *)alignLeading:(RACSignal *)positionSignal {
-	return [[self alignAttribute:NSLayoutAttributeLeading to:positionSignal] setNameWithFormat:@"[%@] -alignLeading: %@", self.name, positionSignal];
+	return [[self alignAttribute:NSLayoutAttributeLeading to:positionSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignLeading: %@", self.name, positionSignal)];
 }
 
 - (RACSignal *)alignTrailing:(RACSignal *)positionSignal {
-	return [[self alignAttribute:NSLayoutAttributeTrailing to:positionSignal] setNameWithFormat:@"[%@] -alignTrailing: %@", self.name, positionSignal];
+	return [[self alignAttribute:NSLayoutAttributeTrailing to:positionSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignTrailing: %@", self.name, positionSignal)];
 }
 
 - (RACSignal *)alignWidth:(RACSignal *)amountSignal {
-	return [[self alignAttribute:NSLayoutAttributeWidth to:amountSignal] setNameWithFormat:@"[%@] -alignWidth: %@", self.name, amountSignal];
+	return [[self alignAttribute:NSLayoutAttributeWidth to:amountSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignWidth: %@", self.name, amountSignal)];
 }
 
 - (RACSignal *)alignHeight:(RACSignal *)amountSignal {
-	return [[self alignAttribute:NSLayoutAttributeHeight to:amountSignal] setNameWithFormat:@"[%@] -alignHeight: %@", self.name, amountSignal];
+	return [[self alignAttribute:NSLayoutAttributeHeight to:amountSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignHeight: %@", self.name, amountSignal)];
 }
 
 - (RACSignal *)alignCenterX:(RACSignal *)positionSignal {
-	return [[self alignAttribute:NSLayoutAttributeCenterX to:positionSignal] setNameWithFormat:@"[%@] -alignCenterX: %@", self.name, positionSignal];
+	return [[self alignAttribute:NSLayoutAttributeCenterX to:positionSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignCenterX: %@", self.name, positionSignal)];
 }
 
 - (RACSignal *)alignCenterY:(RACSignal *)positionSignal {
-	return [[self alignAttribute:NSLayoutAttributeCenterY to:positionSignal] setNameWithFormat:@"[%@] -alignCenterY: %@", self.name, positionSignal];
+	return [[self alignAttribute:NSLayoutAttributeCenterY to:positionSignal] rcl_setNameWithBlock:RCLName(@"[%@] -alignCenterY: %@", self.name, positionSignal)];
 }
 
 - (RACSignal *)alignBaseline:(RACSignal *)baselineSignal toBaseline:(RACSignal *)referenceBaselineSignal ofRect:(RACSignal *)referenceRectSignal {
@@ -598,68 +781,54 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 	NSParameterAssert(referenceBaselineSignal != nil);
 	NSParameterAssert(referenceRectSignal != nil);
 
-	return [[RACSignal
-		combineLatest:@[ referenceBaselineSignal, referenceRectSignal, baselineSignal, self ]
-		reduce:^(NSNumber *referenceBaselineNum, NSValue *referenceRectValue, NSNumber *baselineNum, NSValue *rectValue) {
-			NSAssert([referenceBaselineNum isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", referenceBaselineSignal, referenceBaselineNum);
-			NSAssert([referenceRectValue isKindOfClass:NSValue.class] && referenceRectValue.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", referenceRectSignal, referenceRectValue);
-			NSAssert([baselineNum isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", baselineSignal, baselineNum);
-			NSAssert([rectValue isKindOfClass:NSValue.class] && rectValue.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, rectValue);
-
-			CGRect rect = rectValue.med_rectValue;
-			CGFloat baseline = baselineNum.doubleValue;
-
-			CGRect referenceRect = referenceRectValue.med_rectValue;
-			CGFloat referenceBaseline = referenceBaselineNum.doubleValue;
+	return [[RCLGeometrySignal
+		signalWithOperands:@[ referenceBaselineSignal, referenceRectSignal, baselineSignal, self ]
+		operation:^ RCLGeometry (const RCLGeometry *values) {
+			NSAssert(values[0].type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", referenceBaselineSignal, RCLGeometryBox(values[0]));
+			NSAssert(values[1].type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", referenceRectSignal, RCLGeometryBox(values[1]));
+			NSAssert(values[2].type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", baselineSignal, RCLGeometryBox(values[2]));
+			NSAssert(values[3].type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(values[3]));
 
 			#ifdef RCL_FOR_IPHONE
-				// Flip the baselines so they're relative to a shared minY.
-				baseline = CGRectGetHeight(rect) - baseline + CGRectGetMinY(rect);
-				referenceBaseline = CGRectGetHeight(referenceRect) - referenceBaseline + CGRectGetMinY(referenceRect);
-
-				rect = CGRectOffset(rect, 0, referenceBaseline - baseline);
+				BOOL flipped = YES;
 			#else
-				// Recalculate the baselines relative to a shared minY.
-				baseline += CGRectGetMinY(rect);
-				referenceBaseline += CGRectGetMinY(referenceRect);
-
-				rect = CGRectOffset(rect, 0, referenceBaseline - baseline);
+				BOOL flipped = NO;
 			#endif
 
-			return MEDBox(rect);
+			return RCLGeometryMakeRect(RCLRectAlignBaseline(values[3].rect, values[2].number, values[1].rect, values[0].number, flipped));
 		}]
-		setNameWithFormat:@"[%@] -alignBaseline: %@ toBaseline: %@ ofRect: %@", self.name, baselineSignal, referenceBaselineSignal, referenceRectSignal];
+		rcl_setNameWithBlock:RCLName(@"[%@] -alignBaseline: %@ toBaseline: %@ ofRect: %@", self.name, baselineSignal, referenceBaselineSignal, referenceRectSignal)];
 }
 
 - (RACSignal *)insetBy:(RACSignal *)insetSignal nullRect:(CGRect)nullRect {
 	NSParameterAssert(insetSignal != nil);
-	
-	return [[RACSignal combineLatest:@[ insetSignal, self ] reduce:^(NSValue *insets, NSValue *rect) {
-		NSAssert([insets isKindOfClass:NSValue.class] && insets.med_geometryStructType == MEDGeometryStructTypeEdgeInsets, @"Value sent by %@ is not an MEDEdgeInsets: %@", self, insets);
-		NSAssert([rect isKindOfClass:NSValue.class] && rect.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, rect);
-		
-		CGRect insetRect = MEDEdgeInsetsInsetRect(rect.med_rectValue, insets.med_edgeInsetsValue);
-		if (CGRectIsNull(insetRect)) {
-			return MEDBox(nullRect);
-		} else {
-			return MEDBox(insetRect);
-		}
-	}] setNameWithFormat:@"[%@] -inset: %@", self.name, insetSignal];
+
+	return [[RCLGeometrySignal signalWithOperands:@[ insetSignal, self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry insets = values[0], rect = values[1];
+
+		NSAssert(insets.type == RCLGeometryTypeEdgeInsets, @"Value sent by %@ is not an MEDEdgeInsets: %@", self, RCLGeometryBox(insets));
+		NSAssert(rect.type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(rect));
+
+		return insetRect(rect.rect, insets.insets, nullRect);
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -inset: %@", self.name, insetSignal)];
 }
 
 - (RACSignal *)insetWidth:(RACSignal *)widthSignal height:(RACSignal *)heightSignal nullRect:(CGRect)nullRect {
 	NSParameterAssert(widthSignal != nil);
 	NSParameterAssert(heightSignal != nil);
 
-	RACSignal *insets = [RACSignal combineLatest:@[ widthSignal, heightSignal ] reduce:^(NSNumber *width, NSNumber *height) {
-		NSAssert([width isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", widthSignal, width);
-		NSAssert([height isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", heightSignal, height);
-		
-		CGFloat widthValue = width.doubleValue;
-		CGFloat heightValue = height.doubleValue;
-		return MEDBox(MEDEdgeInsetsMake(heightValue, widthValue, heightValue, widthValue));
-	}];
-	return [[self insetBy:insets nullRect:nullRect] setNameWithFormat:@"[%@] -insetWidth: %@ height: %@", self.name, widthSignal, heightSignal];
+	// Builds the MEDEdgeInsets inline, instead of sending them through an
+	// intermediate signal.
+	return [[RCLGeometrySignal signalWithOperands:@[ widthSignal, heightSignal, self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry width = values[0], height = values[1], rect = values[2];
+
+		NSAssert(width.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", widthSignal, RCLGeometryBox(width));
+		NSAssert(height.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", heightSignal, RCLGeometryBox(height));
+		NSAssert(rect.type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(rect));
+
+		MEDEdgeInsets insets = MEDEdgeInsetsMake(height.number, width.number, height.number, width.number);
+		return insetRect(rect.rect, insets, nullRect);
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -insetWidth: %@ height: %@", self.name, widthSignal, heightSignal)];
 }
 
 - (RACSignal *)insetTop:(RACSignal *)topSignal left:(RACSignal *)leftSignal bottom:(RACSignal *)bottomSignal right:(RACSignal *)rightSignal nullRect:(CGRect)nullRect {
@@ -667,107 +836,80 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 	NSParameterAssert(leftSignal != nil);
 	NSParameterAssert(bottomSignal != nil);
 	NSParameterAssert(rightSignal != nil);
-	
-	RACSignal *insets = [RACSignal combineLatest:@[ topSignal, leftSignal, bottomSignal, rightSignal ] reduce:^(NSNumber *top, NSNumber *left, NSNumber *bottom, NSNumber *right) {
-		NSAssert([top isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", topSignal, top);
-		NSAssert([left isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", leftSignal, left);
-		NSAssert([bottom isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", bottomSignal, bottom);
-		NSAssert([right isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", rightSignal, right);
-		
-		return MEDBox(MEDEdgeInsetsMake(top.doubleValue, left.doubleValue, bottom.doubleValue, right.doubleValue));
-	}];
-	return [[self insetBy:insets nullRect:nullRect] setNameWithFormat:@"[%@] -insetTop: %@ left: %@ bottom: %@ right: %@", self.name, topSignal, leftSignal, bottomSignal, rightSignal];
-}
-
-- (RACSignal *)offsetByAmount:(RACSignal *)amountSignal towardEdge:(NSLayoutAttribute)edgeAttribute {
-	NSParameterAssert(amountSignal != nil);
 
-	return [combineAttributeAndSignals(edgeAttribute, @[ amountSignal, self ], ^ id (NSNumber *edge, NSNumber *num, NSValue *value) {
-		NSAssert(edge != nil, @"NSLayoutAttribute does not represent an edge: %li", (long)edgeAttribute);
-		NSAssert([num isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", amountSignal, num);
-		NSAssert([value isKindOfClass:NSValue.class], @"Value sent by %@ is not an NSValue: %@", self, value);
+	return [[RCLGeometrySignal signalWithOperands:@[ topSignal, leftSignal, bottomSignal, rightSignal, self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry top = values[0], left = values[1], bottom = values[2], right = values[3], rect = values[4];
 
-		CGFloat n = num.doubleValue;
-		CGRect rect = CGRectZero;
-
-		switch (value.med_geometryStructType) {
-			case MEDGeometryStructTypeRect:
-				rect = value.med_rectValue;
-				break;
+		NSAssert(top.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", topSignal, RCLGeometryBox(top));
+		NSAssert(left.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", leftSignal, RCLGeometryBox(left));
+		NSAssert(bottom.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", bottomSignal, RCLGeometryBox(bottom));
+		NSAssert(right.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", rightSignal, RCLGeometryBox(right));
+		NSAssert(rect.type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(rect));
 
-			case MEDGeometryStructTypePoint:
-				rect.origin = value.med_pointValue;
-				break;
+		MEDEdgeInsets insets = MEDEdgeInsetsMake(top.number, left.number, bottom.number, right.number);
+		return insetRect(rect.rect, insets, nullRect);
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -insetTop: %@ left: %@ bottom: %@ right: %@", self.name, topSignal, leftSignal, bottomSignal, rightSignal)];
+}
 
-			default:
-				NSAssert(NO, @"Value sent by %@ is not a CGRect or CGPoint: %@", self, value);
-		}
+- (RACSignal *)offsetByAmount:(RACSignal *)amountSignal towardEdge:(NSLayoutAttribute)edgeAttribute {
+	NSParameterAssert(amountSignal != nil);
 
-		switch (edge.unsignedIntegerValue) {
-			case CGRectMinXEdge:
-				rect.origin.x -= n;
-				break;
+	return [combineAttributeAndSignals(edgeAttribute, @[ amountSignal, self ], ^ RCLGeometry (NSInteger edge, const RCLGeometry *values) {
+		NSAssert(edge != RCLNoEdge, @"NSLayoutAttribute does not represent an edge: %li", (long)edgeAttribute);
+		NSAssert(values[0].type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", amountSignal, RCLGeometryBox(values[0]));
 
-			case CGRectMinYEdge:
-				rect.origin.y -= n;
-				break;
+		CGFloat n = values[0].number;
+		RCLGeometry value = values[1];
 
-			case CGRectMaxXEdge:
-				rect.origin.x += n;
-				break;
+		switch (value.type) {
+			case RCLGeometryTypeRect:
+				return RCLGeometryMakeRect(RCLRectOffsetTowardEdge(value.rect, n, (RCLRectEdge)edge));
 
-			case CGRectMaxYEdge:
-				rect.origin.y += n;
-				break;
+			case RCLGeometryTypePoint:
+				return RCLGeometryMakePoint(RCLPointOffsetTowardEdge(value.point, n, (RCLRectEdge)edge));
 
 			default:
-				NSAssert(NO, @"Unrecognized CGRectEdge: %@", edge);
-				return nil;
-		}
-
-		if (value.med_geometryStructType == MEDGeometryStructTypePoint) {
-			return MEDBox(rect.origin);
-		} else {
-			return MEDBox(CGRectStandardize(rect));
+				NSAssert(NO, @"Value sent by %@ is not a CGRect or CGPoint: %@", self, RCLGeometryBox(value));
+				return RCLGeometryNone;
 		}
-	}) setNameWithFormat:@"[%@] -offsetByAmount: %@ towardEdge: %li", self.name, amountSignal, (long)edgeAttribute];
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -offsetByAmount: %@ towardEdge: %li", self.name, amountSignal, (long)edgeAttribute)];
 }
 
 - (RACSignal *)moveLeft:(RACSignal *)amountSignal {
-	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeLeft] setNameWithFormat:@"[%@] -moveLeft: %@", self.name, amountSignal];
+	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeLeft] rcl_setNameWithBlock:RCLName(@"[%@] -moveLeft: %@", self.name, amountSignal)];
 }
 
 - (RACSignal *)moveRight:(RACSignal *)amountSignal {
-	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeRight] setNameWithFormat:@"[%@] -moveRight: %@", self.name, amountSignal];
+	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeRight] rcl_setNameWithBlock:RCLName(@"[%@] -moveRight: %@", self.name, amountSignal)];
 }
 
 - (RACSignal *)moveUp:(RACSignal *)amountSignal {
-	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeTop] setNameWithFormat:@"[%@] -moveUp: %@", self.name, amountSignal];
+	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeTop] rcl_setNameWithBlock:RCLName(@"[%@] -moveUp: %@", self.name, amountSignal)];
 }
 
 - (RACSignal *)moveDown:(RACSignal *)amountSignal {
-	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeBottom] setNameWithFormat:@"[%@] -moveDown: %@", self.name, amountSignal];
+	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeBottom] rcl_setNameWithBlock:RCLName(@"[%@] -moveDown: %@", self.name, amountSignal)];
 }
 
 - (RACSignal *)moveLeadingOutward:(RACSignal *)amountSignal {
-	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeLeading] setNameWithFormat:@"[%@] -moveLeadingOutward: %@", self.name, amountSignal];
+	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeLeading] rcl_setNameWithBlock:RCLName(@"[%@] -moveLeadingOutward: %@", self.name, amountSignal)];
 }
 
 - (RACSignal *)moveTrailingOutward:(RACSignal *)amountSignal {
-	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeTrailing] setNameWithFormat:@"[%@] -moveTrailingOutward: %@", self.name, amountSignal];
+	return [[self offsetByAmount:amountSignal towardEdge:NSLayoutAttributeTrailing] rcl_setNameWithBlock:RCLName(@"[%@] -moveTrailingOutward: %@", self.name, amountSignal)];
 }
 
 - (RACSignal *)extendAttribute:(NSLayoutAttribute)attribute byAmount:(RACSignal *)amountSignal {
 	NSParameterAssert(amountSignal != nil);
 
-	return [combineAttributeAndSignals(attribute, @[ amountSignal, self ], ^ id (NSNumber *edge, NSNumber *amount, NSValue *value) {
-		NSAssert([amount isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", amountSignal, amount);
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, value);
+	return [combineAttributeAndSignals(attribute, @[ amountSignal, self ], ^ RCLGeometry (NSInteger edge, const RCLGeometry *values) {
+		NSAssert(values[0].type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", amountSignal, RCLGeometryBox(values[0]));
+		NSAssert(values[1].type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(values[1]));
 
-		CGFloat n = amount.doubleValue;
-		CGRect rect = value.med_rectValue;
+		CGFloat n = values[0].number;
+		CGRect rect = values[1].rect;
 
-		if (edge == nil) {
+		if (edge == RCLNoEdge) {
 			switch (attribute) {
 				case NSLayoutAttributeWidth:
 					rect.size.width += n;
@@ -781,91 +923,158 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 
 				default:
 					NSAssert(NO, @"NSLayoutAttribute cannot be extended: %li", (long)attribute);
-					return nil;
+					return RCLGeometryNone;
 			}
 		} else {
-			rect = MEDRectGrow(rect, n, (CGRectEdge)edge.unsignedIntegerValue);
+			rect = RCLRectGrow(rect, n, (RCLRectEdge)edge);
 		}
 
-		return MEDBox(CGRectStandardize(rect));
-	}) setNameWithFormat:@"[%@] -extendAttribute: %li byAmount: %@", self.name, (long)attribute, amountSignal];
+		return RCLGeometryMakeRect(CGRectStandardize(rect));
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -extendAttribute: %li byAmount: %@", self.name, (long)attribute, amountSignal)];
 }
 
 - (RACSignal *)sliceWithAmount:(RACSignal *)amountSignal fromEdge:(NSLayoutAttribute)edgeAttribute {
-	return [[self divideWithAmount:amountSignal fromEdge:edgeAttribute][0] setNameWithFormat:@"[%@] -sliceWithAmount: %@ fromEdge: %li", self.name, amountSignal, (long)edgeAttribute];
+	NSParameterAssert(amountSignal != nil);
+
+	// Only one half is needed, so don't pay for sharing the division.
+	return [combineAttributeAndSignals(edgeAttribute, @[ amountSignal, RACSignal.zero, self ], ^ RCLGeometry (NSInteger edge, const RCLGeometry *values) {
+		CGRect sliceRect = CGRectZero;
+		CGRect remainderRect = CGRectZero;
+		divideRectValues(edge, values, &sliceRect, &remainderRect);
+
+		return RCLGeometryMakeRect(sliceRect);
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -sliceWithAmount: %@ fromEdge: %li", self.name, amountSignal, (long)edgeAttribute)];
 }
 
 - (RACSignal *)remainderAfterSlicingAmount:(RACSignal *)amountSignal fromEdge:(NSLayoutAttribute)edgeAttribute {
-	return [[self divideWithAmount:amountSignal fromEdge:edgeAttribute][1] setNameWithFormat:@"[%@] -remainderAfterSlicingAmount: %@ fromEdge: %li", self.name, amountSignal, (long)edgeAttribute];
+	NSParameterAssert(amountSignal != nil);
+
+	return [combineAttributeAndSignals(edgeAttribute, @[ amountSignal, RACSignal.zero, self ], ^ RCLGeometry (NSInteger edge, const RCLGeometry *values) {
+		CGRect sliceRect = CGRectZero;
+		CGRect remainderRect = CGRectZero;
+		divideRectValues(edge, values, &sliceRect, &remainderRect);
+
+		return RCLGeometryMakeRect(remainderRect);
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -remainderAfterSlicingAmount: %@ fromEdge: %li", self.name, amountSignal, (long)edgeAttribute)];
 }
 
 - (RACTuple *)divideWithAmount:(RACSignal *)sliceAmountSignal fromEdge:(NSLayoutAttribute)edgeAttribute {
-	return [self divideWithAmount:sliceAmountSignal padding:[RACSignal return:@0] fromEdge:edgeAttribute];
+	return [self divideWithAmount:sliceAmountSignal padding:RACSignal.zero fromEdge:edgeAttribute];
 }
 
 - (RACTuple *)divideWithAmount:(RACSignal *)amountSignal padding:(RACSignal *)paddingSignal fromEdge:(NSLayoutAttribute)edgeAttribute {
 	NSParameterAssert(amountSignal != nil);
 	NSParameterAssert(paddingSignal != nil);
 
-	RACSignal *combinedSignal = combineAttributeAndSignals(edgeAttribute, @[ amountSignal, paddingSignal, self ], ^ id (NSNumber *edge, NSNumber *amount, NSNumber *padding, NSValue *value) {
-		NSAssert(edge != nil, @"NSLayoutAttribute does not represent an edge: %li", (long)edgeAttribute);
-		NSAssert([amount isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", amountSignal, amount);
-		NSAssert([padding isKindOfClass:NSNumber.class], @"Value sent by %@ is not a number: %@", paddingSignal, padding);
-		NSAssert([value isKindOfClass:NSValue.class] && value.med_geometryStructType == MEDGeometryStructTypeRect, @"Value sent by %@ is not a CGRect: %@", self, value);
+	// Both halves come from one division, which is evaluated once per update
+	// no matter how many times either of them is subscribed to.
+	NSArray *signals = multiplexAttributeAndSignals(edgeAttribute, @[ amountSignal, paddingSignal, self ], 2, ^(NSInteger edge, const RCLGeometry *values, RCLGeometry *results) {
+		CGRect sliceRect = CGRectZero;
+		CGRect remainderRect = CGRectZero;
+		divideRectValues(edge, values, &sliceRect, &remainderRect);
 
-		CGRect rect = value.med_rectValue;
+		results[0] = RCLGeometryMakeRect(sliceRect);
+		results[1] = RCLGeometryMakeRect(remainderRect);
+	});
 
-		CGRect slice = CGRectZero;
-		CGRect remainder = CGRectZero;
-		MEDRectDivideWithPadding(rect, &slice, &remainder, amount.doubleValue, padding.doubleValue, (CGRectEdge)edge.unsignedIntegerValue);
+	RACSignal *sliceSignal = [signals[0] rcl_setNameWithBlock:RCLName(@"[%@] SLICE OF -divideWithAmount: %@ padding: %@ fromEdge: %li", self.name, amountSignal, paddingSignal, (long)edgeAttribute)];
+	RACSignal *remainderSignal = [signals[1] rcl_setNameWithBlock:RCLName(@"[%@] REMAINDER OF -divideWithAmount: %@ padding: %@ fromEdge: %li", self.name, amountSignal, paddingSignal, (long)edgeAttribute)];
 
-		return [RACTuple tupleWithObjects:MEDBox(slice), MEDBox(remainder), nil];
-	});
+	return [RACTuple tupleWithObjects:sliceSignal, remainderSignal, nil];
+}
 
-	NSString *invocationName = [NSString stringWithFormat:@"-divideWithAmount: %@ padding: %@ fromEdge: %li", amountSignal, paddingSignal, (long)edgeAttribute];
+- (NSArray *)divideWithAmounts:(NSArray *)amountSignals padding:(RACSignal *)paddingSignal fromEdge:(NSLayoutAttribute)edgeAttribute mode:(RCLDivisionMode)mode {
+	NSParameterAssert(amountSignals.count > 0);
+	NSParameterAssert(paddingSignal != nil);
 
-	// Now, convert Signal[(Rect, Rect)] into (Signal[Rect], Signal[Rect]).
-	RACSignal *sliceSignal = [[combinedSignal map:^(RACTuple *tuple) {
-		return tuple[0];
-	}] setNameWithFormat:@"[%@] SLICE OF %@", self.name, invocationName];
+	NSUInteger amountCount = amountSignals.count;
+	NSUInteger rectCount = (mode == RCLDivisionModeFill ? amountCount + 1 : amountCount);
 
-	RACSignal *remainderSignal = [[combinedSignal map:^(RACTuple *tuple) {
-		return tuple[1];
-	}] setNameWithFormat:@"[%@] REMAINDER OF %@", self.name, invocationName];
+	RCLKernelDivision division;
+	switch (mode) {
+		case RCLDivisionModeFixed:
+			division = RCLKernelDivisionFixed;
+			break;
 
-	return [RACTuple tupleWithObjects:sliceSignal, remainderSignal, nil];
+		case RCLDivisionModeProportional:
+			division = RCLKernelDivisionProportional;
+			break;
+
+		case RCLDivisionModeFill:
+			division = RCLKernelDivisionFill;
+			break;
+
+		default:
+			NSAssert(NO, @"Unrecognized division mode: %lu", (unsigned long)mode);
+			return nil;
+	}
+
+	NSArray *operands = [amountSignals arrayByAddingObjectsFromArray:@[ paddingSignal, self ]];
+
+	// Every rect comes from a single pass over the amounts, which is shared by
+	// all of the returned signals.
+	NSArray *signals = multiplexAttributeAndSignals(edgeAttribute, operands, rectCount, ^(NSInteger edge, const RCLGeometry *values, RCLGeometry *results) {
+		RCLGeometry padding = values[amountCount];
+		RCLGeometry rect = values[amountCount + 1];
+
+		NSAssert(edge != RCLNoEdge, @"NSLayoutAttribute does not represent an edge: %li", (long)edgeAttribute);
+		NSAssert(padding.type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", paddingSignal, RCLGeometryBox(padding));
+		NSAssert(rect.type == RCLGeometryTypeRect, @"Value sent by %@ is not a CGRect: %@", self, RCLGeometryBox(rect));
+
+		CGFloat stackAmounts[RCL_STACK_BUFFER_COUNT];
+		CGRect stackRects[RCL_STACK_BUFFER_COUNT];
+		CGFloat *amounts = (amountCount <= RCL_STACK_BUFFER_COUNT ? stackAmounts : malloc(sizeof(*amounts) * amountCount));
+		CGRect *rects = (rectCount <= RCL_STACK_BUFFER_COUNT ? stackRects : malloc(sizeof(*rects) * rectCount));
+
+		for (NSUInteger i = 0; i < amountCount; i++) {
+			NSAssert(values[i].type == RCLGeometryTypeNumber, @"Value sent by %@ is not a number: %@", amountSignals[i], RCLGeometryBox(values[i]));
+			amounts[i] = values[i].number;
+		}
+
+		RCLKernelDivideRect(rect.rect, amounts, rectCount, padding.number, (RCLRectEdge)edge, division, rects);
+
+		for (NSUInteger i = 0; i < rectCount; i++) {
+			results[i] = RCLGeometryMakeRect(rects[i]);
+		}
+
+		if (amounts != stackAmounts) free(amounts);
+		if (rects != stackRects) free(rects);
+	});
+
+	NSMutableArray *namedSignals = [NSMutableArray arrayWithCapacity:rectCount];
+	[signals enumerateObjectsUsingBlock:^(RACSignal *signal, NSUInteger index, BOOL *stop) {
+		[namedSignals addObject:[signal rcl_setNameWithBlock:RCLName(@"[%@] RECT %lu OF -divideWithAmounts: %@ padding: %@ fromEdge: %li mode: %lu", self.name, (unsigned long)index, amountSignals, paddingSignal, (long)edgeAttribute, (unsigned long)mode)]];
+	}];
+
+	return namedSignals;
 }
 
 + (RACSignal *)max:(NSArray *)signals {
-	return [latestSortedNumber(signals, NO) setNameWithFormat:@"+max: %@", signals];
+	return [latestExtremeNumber(signals, NO) rcl_setNameWithBlock:RCLName(@"+max: %@", signals)];
 }
 
 + (RACSignal *)min:(NSArray *)signals {
-	return [latestSortedNumber(signals, YES) setNameWithFormat:@"+min: %@", signals];
+	return [latestExtremeNumber(signals, YES) rcl_setNameWithBlock:RCLName(@"+min: %@", signals)];
 }
 
 + (RACSignal *)add:(NSArray *)signals {
-	return [combineSignalsWithOperator(signals, ^(CGFloat a, CGFloat b) {
-		return a + b;
-	}) setNameWithFormat:@"+add: %@", signals];
+	return [sumSignals(signals, NO) rcl_setNameWithBlock:RCLName(@"+add: %@", signals)];
 }
 
 + (RACSignal *)subtract:(NSArray *)signals {
-	return [combineSignalsWithOperator(signals, ^(CGFloat a, CGFloat b) {
-		return a - b;
-	}) setNameWithFormat:@"+subtract: %@", signals];
+	return [sumSignals(signals, YES) rcl_setNameWithBlock:RCLName(@"+subtract: %@", signals)];
 }
 
 + (RACSignal *)multiply:(NSArray *)signals {
 	return [combineSignalsWithOperator(signals, ^(CGFloat a, CGFloat b) {
 		return a * b;
-	}) setNameWithFormat:@"+multiply: %@", signals];
+	}) rcl_setNameWithBlock:RCLName(@"+multiply: %@", signals)];
 }
 
 + (RACSignal *)divide:(NSArray *)signals {
 	return [combineSignalsWithOperator(signals, ^(CGFloat a, CGFloat b) {
 		return a / b;
-	}) setNameWithFormat:@"+divide: %@", signals];
+	}) rcl_setNameWithBlock:RCLName(@"+divide: %@", signals)];
 }
 
 - (RACSignal *)plus:(RACSignal *)addendSignal {
@@ -873,7 +1082,7 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 
 	return [combineSignalsWithOperator(@[ self, addendSignal ], ^(CGFloat a, CGFloat b) {
 		return a + b;
-	}) setNameWithFormat:@"[%@] -plus: %@", self, addendSignal];
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -plus: %@", self, addendSignal)];
 }
 
 - (RACSignal *)minus:(RACSignal *)subtrahendSignal {
@@ -881,7 +1090,7 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 
 	return [combineSignalsWithOperator(@[ self, subtrahendSignal ], ^(CGFloat a, CGFloat b) {
 		return a - b;
-	}) setNameWithFormat:@"[%@] -minus: %@", self, subtrahendSignal];
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -minus: %@", self, subtrahendSignal)];
 }
 
 - (RACSignal *)multipliedBy:(RACSignal *)factorSignal {
@@ -889,7 +1098,7 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 
 	return [combineSignalsWithOperator(@[ self, factorSignal ], ^(CGFloat a, CGFloat b) {
 		return a * b;
-	}) setNameWithFormat:@"[%@] -multipliedBy: %@", self, factorSignal];
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -multipliedBy: %@", self, factorSignal)];
 }
 
 - (RACSignal *)dividedBy:(RACSignal *)denominatorSignal {
@@ -897,108 +1106,127 @@ static RACSignal *combineAttributeAndSignals(NSLayoutAttribute attribute, NSArra
 
 	return [combineSignalsWithOperator(@[ self, denominatorSignal ], ^(CGFloat a, CGFloat b) {
 		return a / b;
-	}) setNameWithFormat:@"[%@] -dividedBy: %@", self, denominatorSignal];
+	}) rcl_setNameWithBlock:RCLName(@"[%@] -dividedBy: %@", self, denominatorSignal)];
 }
 
 - (RACSignal *)negate {
-	return [[self map:^ id (id value) {
-		if ([value isKindOfClass:NSNumber.class]) {
-			return @(-[value doubleValue]);
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry value = values[0];
+
+		switch (value.type) {
+			case RCLGeometryTypeNumber:
+				value.number *= -1;
+				return value;
+
+			case RCLGeometryTypeRect:
+				value.rect.origin.x *= -1;
+				value.rect.origin.y *= -1;
+				value.rect.size.width *= -1;
+				value.rect.size.height *= -1;
+				value.rect = CGRectStandardize(value.rect);
+				return value;
+
+			case RCLGeometryTypePoint:
+				value.point.x *= -1;
+				value.point.y *= -1;
+				return value;
+
+			case RCLGeometryTypeSize:
+				value.size.width *= -1;
+				value.size.height *= -1;
+				return value;
+
+			default:
+				NSAssert(NO, @"Unsupported type of value to negate: %@", RCLGeometryBox(value));
+				return RCLGeometryNone;
 		}
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -negate", self.name)];
+}
 
-		NSAssert([value isKindOfClass:NSValue.class], @"Expected a number or value, got %@", value);
+- (RACSignal *)floor {
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry value = values[0];
 
-		switch ([value med_geometryStructType]) {
-			case MEDGeometryStructTypeRect: {
-				CGRect rect = [value med_rectValue];
-				rect.origin.x *= -1;
-				rect.origin.y *= -1;
-				rect.size.width *= -1;
-				rect.size.height *= -1;
-				return MEDBox(CGRectStandardize(rect));
-			}
+		switch (value.type) {
+			case RCLGeometryTypeNumber:
+				value.number = floor(value.number);
+				return value;
 
-			case MEDGeometryStructTypePoint: {
-				CGPoint point = [value med_pointValue];
-				point.x *= -1;
-				point.y *= -1;
-				return MEDBox(point);
-			}
+			case RCLGeometryTypeRect:
+				value.rect = MEDRectFloor(value.rect);
+				return value;
 
-			case MEDGeometryStructTypeSize: {
-				CGSize size = [value med_sizeValue];
-				size.width *= -1;
-				size.height *= -1;
-				return MEDBox(size);
-			}
+			case RCLGeometryTypePoint:
+				value.point = MEDPointFloor(value.point);
+				return value;
+
+			case RCLGeometryTypeSize:
+				value.size.width = floor(value.size.width);
+				value.size.height = floor(value.size.height);
+				return value;
 
 			default:
-				NSAssert(NO, @"Unsupported type of value to negate: %@", value);
-				return nil;
+				NSAssert(NO, @"Unsupported type of value to floor: %@", RCLGeometryBox(value));
+				return RCLGeometryNone;
 		}
-	}] setNameWithFormat:@"[%@] -negate", self.name];
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -floor", self.name)];
 }
 
-- (RACSignal *)floor {
-	return [[self map:^ id (id value) {
-		if ([value isKindOfClass:NSNumber.class]) {
-			return @(floor([value doubleValue]));
-		}
+- (RACSignal *)ceil {
+	return [[RCLGeometrySignal signalWithOperands:@[ self ] operation:^ RCLGeometry (const RCLGeometry *values) {
+		RCLGeometry value = values[0];
 
-		NSAssert([value isKindOfClass:NSValue.class], @"Expected a number or value, got %@", value);
+		switch (value.type) {
+			case RCLGeometryTypeNumber:
+				value.number = ceil(value.number);
+				return value;
 
-		switch ([value med_geometryStructType]) {
-			case MEDGeometryStructTypeRect:
-				return MEDBox(MEDRectFloor([value med_rectValue]));
+			case RCLGeometryTypeRect:
+				value.rect = CGRectIntegral(value.rect);
+				return value;
 
-			case MEDGeometryStructTypePoint:
-				return MEDBox(MEDPointFloor([value med_pointValue]));
+			case RCLGeometryTypePoint:
+				value.point.x = floor(value.point.x);
+				value.point.y = floor(value.point.y);
+				return value;
 
-			case MEDGeometryStructTypeSize: {
-				CGSize size = [value med_sizeValue];
-				size.width = floor(size.width);
-				size.height = floor(size.height);
-				return MEDBox(size);
-			}
+			case RCLGeometryTypeSize:
+				value.size.width = ceil(value.size.width);
+				value.size.height = ceil(value.size.height);
+				return value;
 
 			default:
-				NSAssert(NO, @"Unsupported type of value to floor: %@", value);
-				return nil;
+				NSAssert(NO, @"Unsupported type of value to ceil: %@", RCLGeometryBox(value));
+				return RCLGeometryNone;
 		}
-	}] setNameWithFormat:@"[%@] -floor", self.name];
+	}] rcl_setNameWithBlock:RCLName(@"[%@] -ceil", self.name)];
 }
 
-- (RACSignal *)ceil {
-	return [[self map:^ id (id value) {
-		if ([value isKindOfClass:NSNumber.class]) {
-			return @(ceil([value doubleValue]));
-		}
+- (RACSignal *)distinctGeometry {
+	return [self distinctGeometryWithTolerance:0];
+}
 
-		NSAssert([value isKindOfClass:NSValue.class], @"Expected a number or value, got %@", value);
+- (RACSignal *)distinctGeometryWithTolerance:(CGFloat)tolerance {
+	NSCParameterAssert(tolerance >= 0);
 
-		switch ([value med_geometryStructType]) {
-			case MEDGeometryStructTypeRect:
-				return MEDBox(CGRectIntegral([value med_rectValue]));
+	RCLGeometrySignal *signal = nil;
+	if ([self isKindOfClass:RCLGeometrySignal.class]) {
+		signal = (id)self;
+	} else {
+		signal = [RCLGeometrySignal signalWithOperands:@[ self ] operation:^(const RCLGeometry *values) {
+			return values[0];
+		}];
+	}
 
-			case MEDGeometryStructTypePoint: {
-				CGPoint point = [value med_pointValue];
-				point.x = floor(point.x);
-				point.y = floor(point.y);
-				return MEDBox(point);
-			}
+	// A constant only sends one value anyway.
+	if (signal.constant) return signal;
 
-			case MEDGeometryStructTypeSize: {
-				CGSize size = [value med_sizeValue];
-				size.width = ceil(size.width);
-				size.height = ceil(size.height);
-				return MEDBox(size);
-			}
+	return [[signal distinctWithTolerance:tolerance] rcl_setNameWithBlock:RCLName(@"[%@] -distinctGeometryWithTolerance: %f", self.name, (double)tolerance)];
+}
 
-			default:
-				NSAssert(NO, @"Unsupported type of value to ceil: %@", value);
-				return nil;
-		}
-	}] setNameWithFormat:@"[%@] -ceil", self.name];
+- (NSUInteger)rcl_stageCount {
+	// Overridden by RCLGeometrySignal.
+	return 0;
 }
 
 @end
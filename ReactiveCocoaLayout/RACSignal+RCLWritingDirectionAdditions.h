@@ -15,6 +15,10 @@
 //
 // In a left-to-right language (such as English), this would be the left side.
 //
+// The same signal is returned every time. It, +trailingEdgeSignal, and every
+// leading or trailing geometry operator share a single observer of the locale,
+// and a single cached writing direction.
+//
 // Returns a signal of NSNumber-boxed CGRectEdge values.
 + (RACSignal *)leadingEdgeSignal;
 
@@ -23,6 +27,8 @@
 //
 // In a left-to-right language (such as English), this would be the right side.
 //
+// Like +leadingEdgeSignal, the same signal is returned every time.
+//
 // Returns a signal of NSNumber-boxed CGRectEdge values.
 + (RACSignal *)trailingEdgeSignal;
 
@@ -7,41 +7,70 @@
 //
 
 #import "RACSignal+RCLWritingDirectionAdditions.h"
+#import "RCLGeometryCore.h"
+#import "RCLGeometrySignal.h"
 
 // Returns a signal which sends the character direction for the current language,
 // and automatically re-sends it any time the current locale changes.
+//
+// The signal is shared by the whole process, so there is only ever one locale
+// observer, and the language is only looked up when the locale changes. New
+// subscribers immediately receive the latest direction.
 static RACSignal *characterDirectionSignal(void) {
-	return [[[[NSNotificationCenter.defaultCenter rac_addObserverForName:NSCurrentLocaleDidChangeNotification object:nil]
-		startWith:nil]
-		map:^(id _) {
-			NSArray *preferredLanguages = NSLocale.preferredLanguages;
-			return (preferredLanguages.count > 0 ? preferredLanguages[0] : [NSLocale.currentLocale objectForKey:NSLocaleLanguageCode]);
-		}]
-		map:^(NSString *languageCode) {
-			return @([NSLocale characterDirectionForLanguage:languageCode]);
-		}];
+	static RACReplaySubject *directions = nil;
+	static dispatch_once_t onceToken;
+
+	dispatch_once(&onceToken, ^{
+		directions = [RACReplaySubject replaySubjectWithCapacity:1];
+		[directions setNameWithFormat:@"characterDirectionSignal()"];
+
+		// This observer lives as long as the process does.
+		[[[[[NSNotificationCenter.defaultCenter rac_addObserverForName:NSCurrentLocaleDidChangeNotification object:nil]
+			startWith:nil]
+			map:^(id _) {
+				NSArray *preferredLanguages = NSLocale.preferredLanguages;
+				return (preferredLanguages.count > 0 ? preferredLanguages[0] : [NSLocale.currentLocale objectForKey:NSLocaleLanguageCode]);
+			}]
+			map:^(NSString *languageCode) {
+				return @([NSLocale characterDirectionForLanguage:languageCode]);
+			}]
+			distinctUntilChanged]
+			subscribe:directions];
+	});
+
+	return directions;
 }
 
 @implementation RACSignal (RCLWritingDirectionAdditions)
 
 + (RACSignal *)leadingEdgeSignal {
-	return [[characterDirectionSignal() map:^(NSNumber *direction) {
-		if (direction.unsignedIntegerValue == NSLocaleLanguageDirectionRightToLeft) {
-			return @(CGRectMaxXEdge);
-		} else {
-			return @(CGRectMinXEdge);
-		}
-	}] setNameWithFormat:@"+leadingEdgeSignal"];
+	static RACSignal *signal = nil;
+	static dispatch_once_t onceToken;
+
+	// This is a geometry signal, so that the operators which use it can fuse
+	// it, and subscribe directly to the shared direction.
+	dispatch_once(&onceToken, ^{
+		signal = [[RCLGeometrySignal signalWithOperands:@[ characterDirectionSignal() ] operation:^(const RCLGeometry *values) {
+			BOOL rightToLeft = ((NSUInteger)values[0].number == NSLocaleLanguageDirectionRightToLeft);
+			return RCLGeometryMakeNumber(RCLLeadingEdge(rightToLeft));
+		}] setNameWithFormat:@"+leadingEdgeSignal"];
+	});
+
+	return signal;
 }
 
 + (RACSignal *)trailingEdgeSignal {
-	return [[characterDirectionSignal() map:^(NSNumber *direction) {
-		if (direction.unsignedIntegerValue == NSLocaleLanguageDirectionRightToLeft) {
-			return @(CGRectMinXEdge);
-		} else {
-			return @(CGRectMaxXEdge);
-		}
-	}] setNameWithFormat:@"+trailingEdgeSignal"];
+	static RACSignal *signal = nil;
+	static dispatch_once_t onceToken;
+
+	dispatch_once(&onceToken, ^{
+		signal = [[RCLGeometrySignal signalWithOperands:@[ characterDirectionSignal() ] operation:^(const RCLGeometry *values) {
+			BOOL rightToLeft = ((NSUInteger)values[0].number == NSLocaleLanguageDirectionRightToLeft);
+			return RCLGeometryMakeNumber(RCLTrailingEdge(rightToLeft));
+		}] setNameWithFormat:@"+trailingEdgeSignal"];
+	});
+
+	return signal;
 }
 
 @end
@@ -0,0 +1,48 @@
+//
+//  RCLAssignmentCoalescer.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <ReactiveCocoa/ReactiveCocoa.h>
+
+// Stages values to be assigned to object properties, then applies only the
+// latest value for each property when flushed.
+//
+// This is used by RCLRectAssignmentTrampoline to avoid applying layout values
+// which would be overwritten before they could ever be displayed.
+@interface RCLAssignmentCoalescer : NSObject
+
+// The scheduler upon which staged values are applied.
+@property (nonatomic, strong, readonly) RACScheduler *scheduler;
+
+// Initializes the receiver to flush on the given scheduler.
+//
+// scheduler - The scheduler upon which to apply staged values. This must not
+//             be nil.
+- (id)initWithScheduler:(RACScheduler *)scheduler;
+
+// Stages `value` to be set at `keyPath` on `object`, replacing any value
+// already staged for the same key path and object.
+//
+// If a flush is not already pending, one is scheduled upon the receiver's
+// `scheduler`. Objects are not retained while their values are staged.
+//
+// This method is thread-safe.
+- (void)stageValue:(id)value forKeyPath:(NSString *)keyPath onObject:(NSObject *)object;
+
+// Discards any value staged for `keyPath` on `object`, then sets `value`
+// immediately.
+//
+// This method is thread-safe.
+- (void)applyValue:(id)value forKeyPath:(NSString *)keyPath onObject:(NSObject *)object;
+
+// Immediately applies all staged values, as a single layout transaction.
+//
+// If applying a value causes more values to be staged, those will also be
+// applied before this method returns.
+- (void)flush;
+
+@end
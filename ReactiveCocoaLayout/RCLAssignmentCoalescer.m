@@ -0,0 +1,113 @@
+//
+//  RCLAssignmentCoalescer.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLAssignmentCoalescer.h"
+#import "RACSignal+RCLGeometryAdditions.h"
+
+@interface RCLAssignmentCoalescer ()
+
+// Maps each object to an NSMutableDictionary of key paths and the values
+// staged for them. Nil values are staged as NSNull.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMapTable *stagedValues;
+
+// Whether a flush has been scheduled, but not yet started.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, assign) BOOL flushScheduled;
+
+@end
+
+@implementation RCLAssignmentCoalescer
+
+#pragma mark Lifecycle
+
+- (id)initWithScheduler:(RACScheduler *)scheduler {
+	NSCParameterAssert(scheduler != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_scheduler = scheduler;
+	_stagedValues = [NSMapTable weakToStrongObjectsMapTable];
+
+	return self;
+}
+
+#pragma mark Assignment
+
+- (void)stageValue:(id)value forKeyPath:(NSString *)keyPath onObject:(NSObject *)object {
+	NSCParameterAssert(keyPath != nil);
+	NSCParameterAssert(object != nil);
+
+	BOOL needsFlush = NO;
+
+	@synchronized (self) {
+		NSMutableDictionary *values = [self.stagedValues objectForKey:object];
+		if (values == nil) {
+			values = [NSMutableDictionary dictionary];
+			[self.stagedValues setObject:values forKey:object];
+		}
+
+		values[keyPath] = value ?: NSNull.null;
+
+		if (!self.flushScheduled) {
+			self.flushScheduled = YES;
+			needsFlush = YES;
+		}
+	}
+
+	if (needsFlush) {
+		[self.scheduler schedule:^{
+			[self flush];
+		}];
+	}
+}
+
+- (void)applyValue:(id)value forKeyPath:(NSString *)keyPath onObject:(NSObject *)object {
+	NSCParameterAssert(keyPath != nil);
+	NSCParameterAssert(object != nil);
+
+	@synchronized (self) {
+		[[self.stagedValues objectForKey:object] removeObjectForKey:keyPath];
+	}
+
+	[object setValue:value forKeyPath:keyPath];
+}
+
+- (void)flush {
+	@synchronized (self) {
+		self.flushScheduled = NO;
+	}
+
+	// Applying values may cause more to be staged, so keep going until
+	// everything has settled.
+	while (YES) {
+		NSMapTable *stagedValues = nil;
+
+		@synchronized (self) {
+			if (self.stagedValues.count == 0) return;
+
+			stagedValues = [self.stagedValues copy];
+			[self.stagedValues removeAllObjects];
+		}
+
+		RCLPerformLayoutTransaction(^{
+			for (NSObject *object in stagedValues) {
+				NSDictionary *values = [stagedValues objectForKey:object];
+
+				[values enumerateKeysAndObjectsUsingBlock:^(NSString *keyPath, id value, BOOL *stop) {
+					[object setValue:(value == NSNull.null ? nil : value) forKeyPath:keyPath];
+				}];
+			}
+		});
+	}
+}
+
+@end
@@ -0,0 +1,53 @@
+//
+//  RCLBackgroundLayoutQueue.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <ReactiveCocoa/ReactiveCocoa.h>
+
+@class RCLGeometrySignal;
+
+// Evaluates bindings away from the main thread, then commits their rects to
+// views in batches.
+//
+// This is used by RCLRectAssignmentTrampoline when background layout is
+// enabled.
+@interface RCLBackgroundLayoutQueue : NSObject
+
+// The scheduler upon which bindings are evaluated.
+@property (nonatomic, strong, readonly) RACScheduler *evaluationScheduler;
+
+// The scheduler upon which rects are assigned to views.
+@property (nonatomic, strong, readonly) RACScheduler *commitScheduler;
+
+// Initializes the receiver to evaluate and commit upon the given schedulers.
+//
+// evaluationScheduler - The scheduler upon which to compute rects. This must
+//                       not be nil.
+// commitScheduler     - The scheduler upon which to assign rects to views.
+//                       All rects computed in one evaluation are assigned
+//                       together, in a single layout transaction. This must
+//                       not be nil.
+- (id)initWithEvaluationScheduler:(RACScheduler *)evaluationScheduler commitScheduler:(RACScheduler *)commitScheduler;
+
+// Binds `keyPath` on `view` to the values of `signal`.
+//
+// Whenever the operands of `signal` change, the binding is marked dirty, and
+// an evaluation is scheduled if one isn't already pending. Only the operands
+// are observed on the calling thread. The operation of `signal`, and those of
+// any geometry signals upstream of it which aren't `distinct`, are evaluated
+// upon `evaluationScheduler`.
+//
+// This method is thread-safe.
+//
+// signal  - The signal of rects to bind. This must not be `constant`.
+// keyPath - The key path to assign values to.
+// view    - The view to bind. This is not retained.
+//
+// Returns a disposable which will remove the binding.
+- (RACDisposable *)bindSignal:(RCLGeometrySignal *)signal toKeyPath:(NSString *)keyPath onView:(id)view;
+
+@end
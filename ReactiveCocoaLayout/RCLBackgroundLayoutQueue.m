@@ -0,0 +1,158 @@
+//
+//  RCLBackgroundLayoutQueue.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLBackgroundLayoutQueue.h"
+#import "RACSignal+RCLAnimationAdditions.h"
+#import "RCLAssignmentCoalescer.h"
+#import "RCLGeometrySignal.h"
+
+// A key path of a view, bound to a lazy geometry subscription.
+@interface RCLBackgroundLayoutBinding : NSObject
+
+// The view to assign values to.
+@property (nonatomic, weak) id view;
+
+// The key path to assign values to.
+@property (nonatomic, copy) NSString *keyPath;
+
+// The subscription supplying values.
+@property (nonatomic, strong) id<RCLLazyGeometrySubscription> subscription;
+
+@end
+
+@interface RCLBackgroundLayoutQueue ()
+
+// Applies evaluated rects upon `commitScheduler`.
+@property (nonatomic, strong, readonly) RCLAssignmentCoalescer *coalescer;
+
+// The RCLBackgroundLayoutBindings which have become dirty, and have not been
+// evaluated yet.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMutableArray *dirtyBindings;
+
+// Whether an evaluation has been scheduled, but not yet started.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, assign) BOOL evaluationScheduled;
+
+// Evaluates every dirty binding, and stages the results to be committed.
+- (void)evaluate;
+
+@end
+
+@implementation RCLBackgroundLayoutQueue
+
+#pragma mark Lifecycle
+
+- (id)initWithEvaluationScheduler:(RACScheduler *)evaluationScheduler commitScheduler:(RACScheduler *)commitScheduler {
+	NSCParameterAssert(evaluationScheduler != nil);
+	NSCParameterAssert(commitScheduler != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_evaluationScheduler = evaluationScheduler;
+	_commitScheduler = commitScheduler;
+	_coalescer = [[RCLAssignmentCoalescer alloc] initWithScheduler:commitScheduler];
+	_dirtyBindings = [NSMutableArray array];
+
+	return self;
+}
+
+#pragma mark Binding
+
+- (RACDisposable *)bindSignal:(RCLGeometrySignal *)signal toKeyPath:(NSString *)keyPath onView:(id)view {
+	NSCParameterAssert(signal != nil);
+	NSCParameterAssert(keyPath != nil);
+	NSCParameterAssert(view != nil);
+
+	RCLBackgroundLayoutBinding *binding = [[RCLBackgroundLayoutBinding alloc] init];
+	binding.view = view;
+	binding.keyPath = keyPath;
+
+	// The subscription retains this block, so only capture the binding weakly.
+	__weak RCLBackgroundLayoutBinding *weakBinding = binding;
+
+	binding.subscription = [signal subscribeLazily:^{
+		RCLBackgroundLayoutBinding *binding = weakBinding;
+		if (binding == nil) return;
+
+		// Animated changes need to be applied right away, or they won't be
+		// part of the animation.
+		if (RCLIsInAnimatedSignal() && binding.subscription != nil) {
+			id view = binding.view;
+			RCLGeometry value = [binding.subscription takeDirtyValue];
+			if (view != nil && value.type != RCLGeometryTypeNone) {
+				[self.coalescer applyValue:RCLGeometryBox(value) forKeyPath:binding.keyPath onObject:view];
+			}
+
+			return;
+		}
+
+		BOOL needsEvaluation = NO;
+
+		@synchronized (self) {
+			[self.dirtyBindings addObject:binding];
+
+			if (!self.evaluationScheduled) {
+				self.evaluationScheduled = YES;
+				needsEvaluation = YES;
+			}
+		}
+
+		if (needsEvaluation) {
+			[self.evaluationScheduler schedule:^{
+				[self evaluate];
+			}];
+		}
+	} error:^(NSError *error) {
+		NSCAssert(NO, @"Received error from %@ in binding for key path \"%@\" on %@: %@", signal, keyPath, weakBinding.view, error);
+
+		// Log the error if we're running with assertions disabled.
+		NSLog(@"Received error from %@ in binding for key path \"%@\" on %@: %@", signal, keyPath, weakBinding.view, error);
+	}];
+
+	return [RACDisposable disposableWithBlock:^{
+		[binding.subscription dispose];
+
+		@synchronized (self) {
+			[self.dirtyBindings removeObjectIdenticalTo:binding];
+		}
+	}];
+}
+
+#pragma mark Evaluation
+
+- (void)evaluate {
+	NSArray *bindings = nil;
+
+	@synchronized (self) {
+		self.evaluationScheduled = NO;
+
+		bindings = [self.dirtyBindings copy];
+		[self.dirtyBindings removeAllObjects];
+	}
+
+	// Everything staged here is committed in one flush of the coalescer.
+	for (RCLBackgroundLayoutBinding *binding in bindings) {
+		id view = binding.view;
+		if (view == nil) continue;
+
+		RCLGeometry value = [binding.subscription takeDirtyValue];
+		if (value.type == RCLGeometryTypeNone) continue;
+
+		[self.coalescer stageValue:RCLGeometryBox(value) forKeyPath:binding.keyPath onObject:view];
+	}
+}
+
+@end
+
+@implementation RCLBackgroundLayoutBinding
+
+@end
@@ -0,0 +1,222 @@
+//
+//  RCLGeometryCore.c
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#include "RCLGeometryCore.h"
+#include <math.h>
+
+const RCLRect RCLRectNull = { { INFINITY, INFINITY }, { 0, 0 } };
+
+bool RCLRectIsNull(RCLRect rect) {
+	return isinf(rect.origin.x) || isinf(rect.origin.y);
+}
+
+bool RCLRectEqualToRect(RCLRect a, RCLRect b) {
+	return a.origin.x == b.origin.x && a.origin.y == b.origin.y && a.size.width == b.size.width && a.size.height == b.size.height;
+}
+
+RCLRect RCLRectStandardize(RCLRect rect) {
+	if (rect.size.width < 0) {
+		rect.origin.x += rect.size.width;
+		rect.size.width = -rect.size.width;
+	}
+
+	if (rect.size.height < 0) {
+		rect.origin.y += rect.size.height;
+		rect.size.height = -rect.size.height;
+	}
+
+	return rect;
+}
+
+RCLFloat RCLRectGetEdge(RCLRect rect, RCLRectEdge edge) {
+	rect = RCLRectStandardize(rect);
+
+	switch (edge) {
+		case RCLRectMinXEdge:
+			return rect.origin.x;
+
+		case RCLRectMinYEdge:
+			return rect.origin.y;
+
+		case RCLRectMaxXEdge:
+			return rect.origin.x + rect.size.width;
+
+		case RCLRectMaxYEdge:
+			return rect.origin.y + rect.size.height;
+	}
+
+	return NAN;
+}
+
+RCLRect RCLRectAlignEdge(RCLRect rect, RCLRectEdge edge, RCLFloat position) {
+	switch (edge) {
+		case RCLRectMinXEdge:
+			rect.origin.x = position;
+			break;
+
+		case RCLRectMinYEdge:
+			rect.origin.y = position;
+			break;
+
+		case RCLRectMaxXEdge:
+			rect.origin.x = position - fabs(rect.size.width);
+			break;
+
+		case RCLRectMaxYEdge:
+			rect.origin.y = position - fabs(rect.size.height);
+			break;
+	}
+
+	return RCLRectStandardize(rect);
+}
+
+void RCLRectDivide(RCLRect rect, RCLRect *slice, RCLRect *remainder, RCLFloat amount, RCLRectEdge edge) {
+	if (RCLRectIsNull(rect)) {
+		if (slice != NULL) *slice = RCLRectNull;
+		if (remainder != NULL) *remainder = RCLRectNull;
+		return;
+	}
+
+	rect = RCLRectStandardize(rect);
+
+	RCLFloat length = (edge == RCLRectMinXEdge || edge == RCLRectMaxXEdge ? rect.size.width : rect.size.height);
+	if (amount < 0) amount = 0;
+	if (amount > length) amount = length;
+
+	RCLRect sliceRect = rect;
+	RCLRect remainderRect = rect;
+
+	switch (edge) {
+		case RCLRectMinXEdge:
+			sliceRect.size.width = amount;
+			remainderRect.origin.x += amount;
+			remainderRect.size.width -= amount;
+			break;
+
+		case RCLRectMinYEdge:
+			sliceRect.size.height = amount;
+			remainderRect.origin.y += amount;
+			remainderRect.size.height -= amount;
+			break;
+
+		case RCLRectMaxXEdge:
+			sliceRect.origin.x += rect.size.width - amount;
+			sliceRect.size.width = amount;
+			remainderRect.size.width -= amount;
+			break;
+
+		case RCLRectMaxYEdge:
+			sliceRect.origin.y += rect.size.height - amount;
+			sliceRect.size.height = amount;
+			remainderRect.size.height -= amount;
+			break;
+	}
+
+	if (slice != NULL) *slice = sliceRect;
+	if (remainder != NULL) *remainder = remainderRect;
+}
+
+void RCLRectDivideWithPadding(RCLRect rect, RCLRect *slice, RCLRect *remainder, RCLFloat amount, RCLFloat padding, RCLRectEdge edge) {
+	RCLRect sliceRect;
+	RCLRect remainderRect;
+	RCLRectDivide(rect, &sliceRect, &remainderRect, amount, edge);
+
+	// Throw away the padding.
+	RCLRectDivide(remainderRect, NULL, &remainderRect, padding, edge);
+
+	if (slice != NULL) *slice = sliceRect;
+	if (remainder != NULL) *remainder = remainderRect;
+}
+
+RCLRect RCLRectGrow(RCLRect rect, RCLFloat amount, RCLRectEdge edge) {
+	rect = RCLRectStandardize(rect);
+
+	switch (edge) {
+		case RCLRectMinXEdge:
+			rect.origin.x -= amount;
+			rect.size.width += amount;
+			break;
+
+		case RCLRectMinYEdge:
+			rect.origin.y -= amount;
+			rect.size.height += amount;
+			break;
+
+		case RCLRectMaxXEdge:
+			rect.size.width += amount;
+			break;
+
+		case RCLRectMaxYEdge:
+			rect.size.height += amount;
+			break;
+	}
+
+	return RCLRectStandardize(rect);
+}
+
+RCLPoint RCLPointOffsetTowardEdge(RCLPoint point, RCLFloat amount, RCLRectEdge edge) {
+	switch (edge) {
+		case RCLRectMinXEdge:
+			point.x -= amount;
+			break;
+
+		case RCLRectMinYEdge:
+			point.y -= amount;
+			break;
+
+		case RCLRectMaxXEdge:
+			point.x += amount;
+			break;
+
+		case RCLRectMaxYEdge:
+			point.y += amount;
+			break;
+	}
+
+	return point;
+}
+
+RCLRect RCLRectOffsetTowardEdge(RCLRect rect, RCLFloat amount, RCLRectEdge edge) {
+	rect.origin = RCLPointOffsetTowardEdge(rect.origin, amount, edge);
+	return RCLRectStandardize(rect);
+}
+
+RCLRect RCLRectInset(RCLRect rect, RCLEdgeInsets insets, bool flipped, RCLRect nullRect) {
+	rect.origin.x += insets.left;
+	rect.origin.y += (flipped ? insets.top : insets.bottom);
+	rect.size.width -= insets.left + insets.right;
+	rect.size.height -= insets.top + insets.bottom;
+
+	if (rect.size.width < 0 || rect.size.height < 0) return nullRect;
+	return rect;
+}
+
+RCLRect RCLRectAlignBaseline(RCLRect rect, RCLFloat baseline, RCLRect referenceRect, RCLFloat referenceBaseline, bool flipped) {
+	RCLRect standardRect = RCLRectStandardize(rect);
+	referenceRect = RCLRectStandardize(referenceRect);
+
+	// Measure both baselines from a shared origin.
+	if (flipped) {
+		baseline = standardRect.size.height - baseline + standardRect.origin.y;
+		referenceBaseline = referenceRect.size.height - referenceBaseline + referenceRect.origin.y;
+	} else {
+		baseline += standardRect.origin.y;
+		referenceBaseline += referenceRect.origin.y;
+	}
+
+	rect.origin.y += referenceBaseline - baseline;
+	return rect;
+}
+
+RCLRectEdge RCLLeadingEdge(bool rightToLeft) {
+	return (rightToLeft ? RCLRectMaxXEdge : RCLRectMinXEdge);
+}
+
+RCLRectEdge RCLTrailingEdge(bool rightToLeft) {
+	return (rightToLeft ? RCLRectMinXEdge : RCLRectMaxXEdge);
+}
@@ -0,0 +1,170 @@
+//
+//  RCLGeometryCore.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#ifndef RCL_GEOMETRY_CORE_H
+#define RCL_GEOMETRY_CORE_H
+
+// The rectangle math behind the geometry operators, as plain C functions over
+// plain structures.
+//
+// This has no dependency upon Foundation, ReactiveCocoa, or Archimedes, so it
+// can be built and tested on any platform (see the Makefile at the root of the
+// repository), and used from any thread.
+//
+// On Apple platforms, the structures are the CoreGraphics ones, so values can
+// be passed back and forth without any conversion. Elsewhere, structures with
+// the same members are defined instead.
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(__APPLE__)
+	#include <CoreGraphics/CGGeometry.h>
+
+	typedef CGFloat RCLFloat;
+	typedef CGPoint RCLPoint;
+	typedef CGSize RCLSize;
+	typedef CGRect RCLRect;
+#else
+	typedef double RCLFloat;
+
+	typedef struct {
+		RCLFloat x;
+		RCLFloat y;
+	} RCLPoint;
+
+	typedef struct {
+		RCLFloat width;
+		RCLFloat height;
+	} RCLSize;
+
+	typedef struct {
+		RCLPoint origin;
+		RCLSize size;
+	} RCLRect;
+#endif
+
+// The amounts by which to inset each side of a rectangle.
+//
+// This has the same layout as MEDEdgeInsets.
+typedef struct {
+	RCLFloat top;
+	RCLFloat left;
+	RCLFloat bottom;
+	RCLFloat right;
+} RCLEdgeInsets;
+
+// An edge of a rectangle.
+//
+// These have the same values as the corresponding CGRectEdge constants.
+typedef enum {
+	RCLRectMinXEdge = 0,
+	RCLRectMinYEdge = 1,
+	RCLRectMaxXEdge = 2,
+	RCLRectMaxYEdge = 3
+} RCLRectEdge;
+
+// The null rectangle, which has the same value as CGRectNull.
+extern const RCLRect RCLRectNull;
+
+static inline RCLRect RCLRectMake(RCLFloat x, RCLFloat y, RCLFloat width, RCLFloat height) {
+	RCLRect rect = { { x, y }, { width, height } };
+	return rect;
+}
+
+static inline RCLEdgeInsets RCLEdgeInsetsMake(RCLFloat top, RCLFloat left, RCLFloat bottom, RCLFloat right) {
+	RCLEdgeInsets insets = { top, left, bottom, right };
+	return insets;
+}
+
+// Whether the given rectangle is the null rectangle, as with CGRectIsNull().
+bool RCLRectIsNull(RCLRect rect);
+
+// Whether two rectangles have identical components.
+bool RCLRectEqualToRect(RCLRect a, RCLRect b);
+
+// Returns an equivalent rectangle with a non-negative width and height, as with
+// CGRectStandardize().
+RCLRect RCLRectStandardize(RCLRect rect);
+
+// Returns the coordinate of the given edge of a rectangle.
+RCLFloat RCLRectGetEdge(RCLRect rect, RCLRectEdge edge);
+
+// Moves a rectangle, without resizing it, so that the given edge lies at
+// `position`.
+//
+// Returns a standardized rectangle.
+RCLRect RCLRectAlignEdge(RCLRect rect, RCLRectEdge edge, RCLFloat position);
+
+// Splits a rectangle in two, as with CGRectDivide().
+//
+// rect      - The rectangle to divide. If this is null, both `slice` and
+//             `remainder` will be null.
+// slice     - If not NULL, set to the part of `rect` within `amount` of
+//             `edge`.
+// remainder - If not NULL, set to the rest of `rect`.
+// amount    - The size of the slice. This is clamped to the size of `rect`, and
+//             negative amounts are treated as 0.
+// edge      - The edge from which to slice.
+void RCLRectDivide(RCLRect rect, RCLRect *slice, RCLRect *remainder, RCLFloat amount, RCLRectEdge edge);
+
+// Like RCLRectDivide(), but removes `padding` from the remainder, next to the
+// slice, as with MEDRectDivideWithPadding().
+void RCLRectDivideWithPadding(RCLRect rect, RCLRect *slice, RCLRect *remainder, RCLFloat amount, RCLFloat padding, RCLRectEdge edge);
+
+// Extends a rectangle outward from the given edge, as with MEDRectGrow().
+//
+// Returns a standardized rectangle.
+RCLRect RCLRectGrow(RCLRect rect, RCLFloat amount, RCLRectEdge edge);
+
+// Moves a point by `amount` toward the given edge.
+RCLPoint RCLPointOffsetTowardEdge(RCLPoint point, RCLFloat amount, RCLRectEdge edge);
+
+// Moves a rectangle by `amount` toward the given edge.
+//
+// Returns a standardized rectangle.
+RCLRect RCLRectOffsetTowardEdge(RCLRect rect, RCLFloat amount, RCLRectEdge edge);
+
+// Insets the sides of a rectangle.
+//
+// rect     - The rectangle to inset.
+// insets   - The amounts by which to inset each side.
+// flipped  - Whether the Y axis points down, as with iOS and flipped views on
+//            OS X. This determines whether `insets.top` is applied to the
+//            minimum or maximum Y edge.
+// nullRect - The rectangle to return if the insets exceed the dimensions of
+//            `rect`. Pass RCLRectNull for the behavior of CGRectInset().
+//
+// Returns the inset rectangle, or `nullRect`.
+RCLRect RCLRectInset(RCLRect rect, RCLEdgeInsets insets, bool flipped, RCLRect nullRect);
+
+// Vertically moves a rectangle, so that its baseline lines up with that of
+// another rectangle.
+//
+// rect              - The rectangle to move.
+// baseline          - The baseline of `rect`, measured from its bottom edge.
+// referenceRect     - The rectangle to align to.
+// referenceBaseline - The baseline of `referenceRect`, measured from its bottom
+//                     edge.
+// flipped           - Whether the Y axis points down, as with iOS and flipped
+//                     views on OS X.
+//
+// Returns the moved rectangle.
+RCLRect RCLRectAlignBaseline(RCLRect rect, RCLFloat baseline, RCLRect referenceRect, RCLFloat referenceBaseline, bool flipped);
+
+// Returns the horizontal edge corresponding to the leading side of a layout.
+//
+// rightToLeft - Whether the layout is for a language written right to left.
+RCLRectEdge RCLLeadingEdge(bool rightToLeft);
+
+// Returns the horizontal edge corresponding to the trailing side of a layout.
+//
+// rightToLeft - Whether the layout is for a language written right to left.
+RCLRectEdge RCLTrailingEdge(bool rightToLeft);
+
+#endif
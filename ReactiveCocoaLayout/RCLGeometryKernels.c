@@ -0,0 +1,353 @@
+//
+//  RCLGeometryKernels.c
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#include "RCLGeometryKernels.h"
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The number of independent accumulators used by the reductions.
+//
+// Splitting a reduction across several accumulators removes the dependency
+// between consecutive iterations, which allows them to be vectorized.
+#define RCL_KERNEL_LANES 4
+
+RCLFloat RCLKernelSum(const RCLFloat *values, size_t count) {
+	RCLFloat lanes[RCL_KERNEL_LANES] = { 0 };
+
+	size_t i = 0;
+	for (; i + RCL_KERNEL_LANES <= count; i += RCL_KERNEL_LANES) {
+		for (size_t lane = 0; lane < RCL_KERNEL_LANES; lane++) {
+			lanes[lane] += values[i + lane];
+		}
+	}
+
+	RCLFloat sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+	for (; i < count; i++) {
+		sum += values[i];
+	}
+
+	return sum;
+}
+
+RCLFloat RCLKernelMinimum(const RCLFloat *values, size_t count) {
+	RCLFloat lanes[RCL_KERNEL_LANES] = { INFINITY, INFINITY, INFINITY, INFINITY };
+
+	size_t i = 0;
+	for (; i + RCL_KERNEL_LANES <= count; i += RCL_KERNEL_LANES) {
+		for (size_t lane = 0; lane < RCL_KERNEL_LANES; lane++) {
+			RCLFloat value = values[i + lane];
+			lanes[lane] = (value < lanes[lane] ? value : lanes[lane]);
+		}
+	}
+
+	RCLFloat minimum = lanes[0];
+	for (size_t lane = 1; lane < RCL_KERNEL_LANES; lane++) {
+		if (lanes[lane] < minimum) minimum = lanes[lane];
+	}
+
+	for (; i < count; i++) {
+		if (values[i] < minimum) minimum = values[i];
+	}
+
+	return minimum;
+}
+
+RCLFloat RCLKernelMaximum(const RCLFloat *values, size_t count) {
+	RCLFloat lanes[RCL_KERNEL_LANES] = { -INFINITY, -INFINITY, -INFINITY, -INFINITY };
+
+	size_t i = 0;
+	for (; i + RCL_KERNEL_LANES <= count; i += RCL_KERNEL_LANES) {
+		for (size_t lane = 0; lane < RCL_KERNEL_LANES; lane++) {
+			RCLFloat value = values[i + lane];
+			lanes[lane] = (value > lanes[lane] ? value : lanes[lane]);
+		}
+	}
+
+	RCLFloat maximum = lanes[0];
+	for (size_t lane = 1; lane < RCL_KERNEL_LANES; lane++) {
+		if (lanes[lane] > maximum) maximum = lanes[lane];
+	}
+
+	for (; i < count; i++) {
+		if (values[i] > maximum) maximum = values[i];
+	}
+
+	return maximum;
+}
+
+RCLRect RCLKernelUnionRects(const RCLRect *rects, size_t count) {
+	RCLFloat minX = INFINITY, minY = INFINITY;
+	RCLFloat maxX = -INFINITY, maxY = -INFINITY;
+
+	for (size_t i = 0; i < count; i++) {
+		RCLRect rect = rects[i];
+		if (RCLRectIsNull(rect)) continue;
+
+		rect = RCLRectStandardize(rect);
+		if (rect.origin.x < minX) minX = rect.origin.x;
+		if (rect.origin.y < minY) minY = rect.origin.y;
+		if (rect.origin.x + rect.size.width > maxX) maxX = rect.origin.x + rect.size.width;
+		if (rect.origin.y + rect.size.height > maxY) maxY = rect.origin.y + rect.size.height;
+	}
+
+	if (minX > maxX) return RCLRectNull;
+	return RCLRectMake(minX, minY, maxX - minX, maxY - minY);
+}
+
+void RCLKernelInsetRects(const RCLRect *rects, RCLRect *results, size_t count, RCLFloat minX, RCLFloat minY, RCLFloat maxX, RCLFloat maxY, RCLRect nullRect) {
+	for (size_t i = 0; i < count; i++) {
+		RCLRect rect = RCLRectStandardize(rects[i]);
+
+		rect.origin.x += minX;
+		rect.origin.y += minY;
+		rect.size.width -= minX + maxX;
+		rect.size.height -= minY + maxY;
+
+		results[i] = (rect.size.width < 0 || rect.size.height < 0 ? nullRect : rect);
+	}
+}
+
+void RCLKernelOffsetRects(const RCLRect *rects, RCLRect *results, size_t count, RCLFloat dx, RCLFloat dy) {
+	for (size_t i = 0; i < count; i++) {
+		RCLRect rect = rects[i];
+
+		rect.origin.x += dx;
+		rect.origin.y += dy;
+
+		results[i] = rect;
+	}
+}
+
+void RCLKernelDivideRect(RCLRect rect, const RCLFloat *amounts, size_t count, RCLFloat padding, RCLRectEdge edge, RCLKernelDivision division, RCLRect *results) {
+	if (count == 0) return;
+
+	if (RCLRectIsNull(rect)) {
+		for (size_t i = 0; i < count; i++) {
+			results[i] = RCLRectNull;
+		}
+
+		return;
+	}
+
+	rect = RCLRectStandardize(rect);
+
+	RCLFloat length = (edge == RCLRectMinXEdge || edge == RCLRectMaxXEdge ? rect.size.width : rect.size.height);
+	if (padding < 0) padding = 0;
+
+	RCLFloat scale = 1;
+	bool fillsLast = (division == RCLKernelDivisionFill);
+
+	if (division == RCLKernelDivisionProportional) {
+		RCLFloat totalWeight = RCLKernelSum(amounts, count);
+
+		RCLFloat available = length - padding * (RCLFloat)(count - 1);
+		if (available < 0) available = 0;
+
+		scale = (totalWeight > 0 ? available / totalWeight : 0);
+
+		// Give the last rectangle exactly what's left, so that rounding
+		// doesn't leave a sliver at the far edge.
+		fillsLast = (totalWeight > 0);
+	}
+
+	// The distance from `edge` to the start of the next rectangle.
+	RCLFloat offset = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		RCLFloat remaining = length - offset;
+
+		RCLFloat amount = (fillsLast && i + 1 == count ? remaining : amounts[i] * scale);
+		if (amount < 0) amount = 0;
+		if (amount > remaining) amount = remaining;
+
+		RCLRect slice = rect;
+
+		switch (edge) {
+			case RCLRectMinXEdge:
+				slice.origin.x += offset;
+				slice.size.width = amount;
+				break;
+
+			case RCLRectMinYEdge:
+				slice.origin.y += offset;
+				slice.size.height = amount;
+				break;
+
+			case RCLRectMaxXEdge:
+				slice.origin.x += remaining - amount;
+				slice.size.width = amount;
+				break;
+
+			case RCLRectMaxYEdge:
+				slice.origin.y += remaining - amount;
+				slice.size.height = amount;
+				break;
+		}
+
+		results[i] = slice;
+
+		offset += amount + padding;
+		if (offset > length) offset = length;
+	}
+}
+
+// The reducer is a segment tree stored in an array, where node 1 is the root,
+// the children of node n are 2n and 2n + 1, and the slots are the leaves
+// beginning at `leafCount`.
+struct RCLKernelReducer {
+	RCLKernelReduction reduction;
+
+	// The number of slots.
+	size_t count;
+
+	// The number of leaves in the tree. This is a power of two, at least as
+	// large as `count`.
+	size_t leafCount;
+
+	size_t componentCount;
+
+	// The number of slots which contain a value.
+	size_t valueCount;
+
+	// The components of each node of the tree.
+	RCLFloat *nodes;
+
+	// Whether each slot contains a value.
+	bool *present;
+};
+
+// Returns the result of reducing nothing.
+static RCLFloat RCLKernelReductionIdentity(RCLKernelReduction reduction) {
+	switch (reduction) {
+		case RCLKernelReductionMinimum:
+			return INFINITY;
+
+		case RCLKernelReductionMaximum:
+			return -INFINITY;
+
+		case RCLKernelReductionSum:
+		default:
+			return 0;
+	}
+}
+
+static RCLFloat RCLKernelReductionCombine(RCLKernelReduction reduction, RCLFloat a, RCLFloat b) {
+	switch (reduction) {
+		case RCLKernelReductionMinimum:
+			return (b < a ? b : a);
+
+		case RCLKernelReductionMaximum:
+			return (b > a ? b : a);
+
+		case RCLKernelReductionSum:
+		default:
+			return a + b;
+	}
+}
+
+RCLKernelReducer *RCLKernelReducerCreate(RCLKernelReduction reduction, size_t count, size_t componentCount) {
+	assert(count > 0);
+	assert(componentCount > 0);
+
+	RCLKernelReducer *reducer = calloc(1, sizeof(*reducer));
+	if (reducer == NULL) return NULL;
+
+	size_t leafCount = 1;
+	while (leafCount < count) leafCount *= 2;
+
+	reducer->reduction = reduction;
+	reducer->count = count;
+	reducer->leafCount = leafCount;
+	reducer->componentCount = componentCount;
+	reducer->nodes = malloc(sizeof(*reducer->nodes) * leafCount * 2 * componentCount);
+	reducer->present = calloc(count, sizeof(*reducer->present));
+
+	if (reducer->nodes == NULL || reducer->present == NULL) {
+		RCLKernelReducerFree(reducer);
+		return NULL;
+	}
+
+	RCLFloat identity = RCLKernelReductionIdentity(reduction);
+	for (size_t i = 0; i < leafCount * 2 * componentCount; i++) {
+		reducer->nodes[i] = identity;
+	}
+
+	return reducer;
+}
+
+void RCLKernelReducerFree(RCLKernelReducer *reducer) {
+	if (reducer == NULL) return;
+
+	free(reducer->nodes);
+	free(reducer->present);
+	free(reducer);
+}
+
+// Replaces the components of a leaf, then recomputes each of its ancestors.
+static void RCLKernelReducerUpdateLeaf(RCLKernelReducer *reducer, size_t index, const RCLFloat *components) {
+	size_t componentCount = reducer->componentCount;
+	size_t node = reducer->leafCount + index;
+
+	memcpy(reducer->nodes + node * componentCount, components, sizeof(*components) * componentCount);
+
+	for (node /= 2; node > 0; node /= 2) {
+		RCLFloat *parent = reducer->nodes + node * componentCount;
+		const RCLFloat *left = reducer->nodes + node * 2 * componentCount;
+		const RCLFloat *right = left + componentCount;
+
+		for (size_t i = 0; i < componentCount; i++) {
+			parent[i] = RCLKernelReductionCombine(reducer->reduction, left[i], right[i]);
+		}
+	}
+}
+
+void RCLKernelReducerSetValue(RCLKernelReducer *reducer, size_t index, const RCLFloat *components) {
+	assert(reducer != NULL);
+	assert(index < reducer->count);
+	assert(components != NULL);
+
+	if (!reducer->present[index]) {
+		reducer->present[index] = true;
+		reducer->valueCount++;
+	}
+
+	RCLKernelReducerUpdateLeaf(reducer, index, components);
+}
+
+void RCLKernelReducerRemoveValue(RCLKernelReducer *reducer, size_t index) {
+	assert(reducer != NULL);
+	assert(index < reducer->count);
+
+	if (!reducer->present[index]) return;
+
+	reducer->present[index] = false;
+	reducer->valueCount--;
+
+	RCLFloat identity[reducer->componentCount];
+	for (size_t i = 0; i < reducer->componentCount; i++) {
+		identity[i] = RCLKernelReductionIdentity(reducer->reduction);
+	}
+
+	RCLKernelReducerUpdateLeaf(reducer, index, identity);
+}
+
+size_t RCLKernelReducerValueCount(const RCLKernelReducer *reducer) {
+	assert(reducer != NULL);
+
+	return reducer->valueCount;
+}
+
+void RCLKernelReducerGetResult(const RCLKernelReducer *reducer, RCLFloat *components) {
+	assert(reducer != NULL);
+	assert(components != NULL);
+
+	memcpy(components, reducer->nodes + reducer->componentCount, sizeof(*components) * reducer->componentCount);
+}
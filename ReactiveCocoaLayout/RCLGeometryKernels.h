@@ -0,0 +1,162 @@
+//
+//  RCLGeometryKernels.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#ifndef RCL_GEOMETRY_KERNELS_H
+#define RCL_GEOMETRY_KERNELS_H
+
+#include "RCLGeometryCore.h"
+
+// Batch operations over contiguous arrays of geometry values.
+//
+// These are plain C functions, with no dependency upon Foundation or
+// ReactiveCocoa, and are written so that the compiler can vectorize them. They
+// back the n-ary operators in RACSignal+RCLGeometryAdditions, but can also be
+// used directly.
+
+// Adds `count` numbers.
+//
+// Returns 0 if `count` is 0.
+RCLFloat RCLKernelSum(const RCLFloat *values, size_t count);
+
+// Finds the smallest of `count` numbers.
+//
+// Returns INFINITY if `count` is 0.
+RCLFloat RCLKernelMinimum(const RCLFloat *values, size_t count);
+
+// Finds the largest of `count` numbers.
+//
+// Returns -INFINITY if `count` is 0.
+RCLFloat RCLKernelMaximum(const RCLFloat *values, size_t count);
+
+// Computes the smallest rectangle containing all of `count` rectangles.
+//
+// Null rectangles are ignored, as with CGRectUnion().
+//
+// Returns RCLRectNull if `count` is 0, or all of the rectangles are null.
+RCLRect RCLKernelUnionRects(const RCLRect *rects, size_t count);
+
+// Insets `count` rectangles by the same amounts.
+//
+// rects    - The rectangles to inset.
+// results  - An array of at least `count` rectangles, which will be filled in
+//            with the standardized, inset rectangles. This may be the same
+//            array as `rects`.
+// count    - The number of rectangles to inset.
+// minX     - The amount to inset from the minimum X edge of each rectangle.
+// minY     - The amount to inset from the minimum Y edge of each rectangle.
+// maxX     - The amount to inset from the maximum X edge of each rectangle.
+// maxY     - The amount to inset from the maximum Y edge of each rectangle.
+// nullRect - The rectangle to use when the insets would result in a negative
+//            width or height.
+void RCLKernelInsetRects(const RCLRect *rects, RCLRect *results, size_t count, RCLFloat minX, RCLFloat minY, RCLFloat maxX, RCLFloat maxY, RCLRect nullRect);
+
+// Moves the origins of `count` rectangles by the same amounts.
+//
+// rects   - The rectangles to offset.
+// results - An array of at least `count` rectangles, which will be filled in
+//           with the offset rectangles. This may be the same array as
+//           `rects`.
+// count   - The number of rectangles to offset.
+// dx      - The amount to add to the X coordinate of each origin.
+// dy      - The amount to add to the Y coordinate of each origin.
+void RCLKernelOffsetRects(const RCLRect *rects, RCLRect *results, size_t count, RCLFloat dx, RCLFloat dy);
+
+// How RCLKernelDivideRect() interprets its amounts.
+//
+// RCLKernelDivisionFixed        - Each amount is the length of one rectangle.
+// RCLKernelDivisionProportional - Each amount is the weight of one rectangle.
+//                                 The length that remains after padding is
+//                                 shared out in proportion to the weights.
+// RCLKernelDivisionFill         - Each amount is the length of one rectangle,
+//                                 except the last, which fills whatever
+//                                 length remains. There is one fewer amount
+//                                 than there are rectangles.
+typedef enum {
+	RCLKernelDivisionFixed,
+	RCLKernelDivisionProportional,
+	RCLKernelDivisionFill
+} RCLKernelDivision;
+
+// Divides a rectangle into `count` consecutive rectangles, starting from the
+// given edge, with padding between each of them.
+//
+// The results are the same as chaining RCLRectDivideWithPadding() upon each
+// remainder, but are computed in a single pass. Rectangles which don't fit
+// within `rect` are clamped to its far edge, with a length of 0.
+//
+// rect     - The rectangle to divide. If this is null, every result will be
+//            RCLRectNull.
+// amounts  - The lengths or weights of the rectangles, as determined by
+//            `division`. For RCLKernelDivisionFill, this only needs to
+//            contain `count - 1` amounts.
+// count    - The number of rectangles to divide `rect` into.
+// padding  - The length to skip between consecutive rectangles.
+// edge     - The edge from which to start dividing.
+// division - How to interpret `amounts`.
+// results  - An array of at least `count` rectangles, which will be filled in
+//            with the divided rectangles, in order from `edge`.
+void RCLKernelDivideRect(RCLRect rect, const RCLFloat *amounts, size_t count, RCLFloat padding, RCLRectEdge edge, RCLKernelDivision division, RCLRect *results);
+
+// A reduction which can be maintained incrementally by an RCLKernelReducer.
+//
+// RCLKernelReductionSum     - Adds the values.
+// RCLKernelReductionMinimum - Finds the smallest value.
+// RCLKernelReductionMaximum - Finds the largest value.
+typedef enum {
+	RCLKernelReductionSum,
+	RCLKernelReductionMinimum,
+	RCLKernelReductionMaximum
+} RCLKernelReduction;
+
+// Maintains the result of a reduction over a fixed number of slots, each of
+// which may be empty or contain a value.
+//
+// Each value is made up of one or more components, which are reduced
+// independently. Changing the value of a single slot takes O(log n) time, and
+// retrieving the result takes O(1) time.
+//
+// A reducer is not thread-safe.
+typedef struct RCLKernelReducer RCLKernelReducer;
+
+// Creates a reducer with `count` empty slots.
+//
+// reduction      - The reduction to perform.
+// count          - The number of slots. This must be greater than 0.
+// componentCount - The number of components in each value. This must be
+//                  greater than 0.
+//
+// Returns a new reducer, which must be destroyed with RCLKernelReducerFree(),
+// or NULL if memory could not be allocated.
+RCLKernelReducer *RCLKernelReducerCreate(RCLKernelReduction reduction, size_t count, size_t componentCount);
+
+// Destroys a reducer created with RCLKernelReducerCreate().
+void RCLKernelReducerFree(RCLKernelReducer *reducer);
+
+// Stores a value in the given slot, replacing any previous value.
+//
+// components - The components of the value. This must contain as many
+//              components as were given when creating the reducer.
+void RCLKernelReducerSetValue(RCLKernelReducer *reducer, size_t index, const RCLFloat *components);
+
+// Empties the given slot.
+void RCLKernelReducerRemoveValue(RCLKernelReducer *reducer, size_t index);
+
+// Returns the number of slots which contain a value.
+size_t RCLKernelReducerValueCount(const RCLKernelReducer *reducer);
+
+// Retrieves the result of the reduction over all slots which contain a value.
+//
+// If no slots contain a value, the result is that of an empty reduction: 0 for
+// a sum, INFINITY for a minimum, and -INFINITY for a maximum.
+//
+// components - An array which will be filled in with the components of the
+//              result. This must have room for as many components as were
+//              given when creating the reducer.
+void RCLKernelReducerGetResult(const RCLKernelReducer *reducer, RCLFloat *components);
+
+#endif
@@ -0,0 +1,307 @@
+//
+//  RCLGeometrySignal.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Archimedes/Archimedes.h>
+#import <ReactiveCocoa/ReactiveCocoa.h>
+
+// The kind of value stored in an RCLGeometry.
+//
+// RCLGeometryTypeNone       - No value. Operations may return this to avoid
+//                             sending anything for an update.
+// RCLGeometryTypeNumber     - A CGFloat.
+// RCLGeometryTypePoint      - A CGPoint.
+// RCLGeometryTypeSize       - A CGSize.
+// RCLGeometryTypeRect       - A CGRect.
+// RCLGeometryTypeEdgeInsets - An MEDEdgeInsets.
+typedef enum : unsigned char {
+	RCLGeometryTypeNone = 0,
+	RCLGeometryTypeNumber,
+	RCLGeometryTypePoint,
+	RCLGeometryTypeSize,
+	RCLGeometryTypeRect,
+	RCLGeometryTypeEdgeInsets
+} RCLGeometryType;
+
+// An unboxed number or geometry structure, as sent between the operators in
+// RACSignal+RCLGeometryAdditions.
+typedef struct {
+	RCLGeometryType type;
+
+	union {
+		CGFloat number;
+		CGPoint point;
+		CGSize size;
+		CGRect rect;
+		MEDEdgeInsets insets;
+	};
+} RCLGeometry;
+
+// An RCLGeometry containing no value.
+static const RCLGeometry RCLGeometryNone = { .type = RCLGeometryTypeNone };
+
+static inline RCLGeometry RCLGeometryMakeNumber(CGFloat number) {
+	return (RCLGeometry){ .type = RCLGeometryTypeNumber, .number = number };
+}
+
+static inline RCLGeometry RCLGeometryMakePoint(CGPoint point) {
+	return (RCLGeometry){ .type = RCLGeometryTypePoint, .point = point };
+}
+
+static inline RCLGeometry RCLGeometryMakeSize(CGSize size) {
+	return (RCLGeometry){ .type = RCLGeometryTypeSize, .size = size };
+}
+
+static inline RCLGeometry RCLGeometryMakeRect(CGRect rect) {
+	return (RCLGeometry){ .type = RCLGeometryTypeRect, .rect = rect };
+}
+
+static inline RCLGeometry RCLGeometryMakeEdgeInsets(MEDEdgeInsets insets) {
+	return (RCLGeometry){ .type = RCLGeometryTypeEdgeInsets, .insets = insets };
+}
+
+// Unboxes an NSNumber, or an NSValue containing a geometry structure.
+//
+// Returns an RCLGeometry of type RCLGeometryTypeNone if `object` is nil or not
+// one of the supported types.
+RCLGeometry RCLGeometryFromObject(id object);
+
+// Boxes `value` into an NSNumber or NSValue, as appropriate.
+//
+// Returns nil if `value` is of type RCLGeometryTypeNone.
+id RCLGeometryBox(RCLGeometry value);
+
+// Determines whether two geometry values are of the same type and have
+// identical components.
+BOOL RCLGeometryEqualToGeometry(RCLGeometry a, RCLGeometry b);
+
+// Determines whether two geometry values are of the same type, and none of
+// their components differ by more than `tolerance`.
+//
+// If `tolerance` is 0, this is equivalent to RCLGeometryEqualToGeometry().
+BOOL RCLGeometryEqualToGeometryWithTolerance(RCLGeometry a, RCLGeometry b, CGFloat tolerance);
+
+// Computes a new value from the latest values of a geometry signal's operands.
+//
+// operands - A C array containing the latest value of each operand, in the
+//            order in which the operands were given.
+typedef RCLGeometry (^RCLGeometryOperation)(const RCLGeometry *operands);
+
+// Computes several values at once from the latest values of a geometry
+// signal's operands.
+//
+// operands - A C array containing the latest value of each operand, in the
+//            order in which the operands were given.
+// results  - A C array to fill in with each result of the operation. Any result
+//            left as a value of type RCLGeometryTypeNone will not be sent for
+//            that update.
+typedef void (^RCLGeometryMultipleOperation)(const RCLGeometry *operands, RCLGeometry *results);
+
+// A reduction which a geometry signal can maintain incrementally, instead of
+// evaluating an operation over all of its operands.
+//
+// RCLGeometryReductionSum        - Adds the values of the operands, which must
+//                                  all be numbers, CGPoints, or CGSizes of the
+//                                  same type.
+// RCLGeometryReductionDifference - Like RCLGeometryReductionSum, but subtracts
+//                                  the values of all operands but the first
+//                                  from the value of the first.
+// RCLGeometryReductionMinimum    - Finds the smallest number among the values
+//                                  of the operands. Values which are not
+//                                  numbers are ignored, and nothing is sent if
+//                                  there are no numbers.
+// RCLGeometryReductionMaximum    - Like RCLGeometryReductionMinimum, but finds
+//                                  the largest number.
+typedef enum : unsigned char {
+	RCLGeometryReductionSum,
+	RCLGeometryReductionDifference,
+	RCLGeometryReductionMinimum,
+	RCLGeometryReductionMaximum
+} RCLGeometryReduction;
+
+// A subscription created with -[RCLGeometrySignal subscribeLazily:error:],
+// whose value is only computed when asked for.
+@protocol RCLLazyGeometrySubscription <NSObject>
+
+// Whether any operand has sent a value since the value of the subscription was
+// last taken.
+@property (atomic, assign, readonly, getter = isDirty) BOOL dirty;
+
+// Computes the value of the signal from the latest values of its operands, and
+// clears `dirty`.
+//
+// Returns the new value, or a value of type RCLGeometryTypeNone if the
+// receiver was not dirty, or the operation did not produce a value.
+- (RCLGeometry)takeDirtyValue;
+
+// Stops receiving values from the operands.
+- (void)dispose;
+
+@end
+
+// A signal which applies a pure operation to the latest values of its operands.
+//
+// Values are passed between geometry signals without being boxed. Boxing only
+// occurs when a value is sent to a subscriber which is not another geometry
+// signal.
+//
+// When a geometry signal is used as an operand of another, the two are fused:
+// the new signal subscribes directly to the operands of the inner signal, and
+// evaluates both operations as a single function. A chain of geometry
+// operators therefore results in only one stage of subscriptions.
+//
+// Fusion doesn't change the values which are sent. If an inner operation
+// doesn't produce a value for an update, the last value that it produced is
+// used instead, just as if it had been subscribed to separately.
+@interface RCLGeometrySignal : RACSignal
+
+// The signals combined by the receiver, after fusion.
+@property (nonatomic, copy, readonly) NSArray *operands;
+
+// Whether the receiver has no operands, and so only ever sends a single value.
+//
+// This is true of signals created with +signalWithConstant:object:, and of
+// signals whose operands were all constant. A constant operand is folded into
+// the operation of any geometry signal that uses it, instead of being
+// subscribed to.
+@property (nonatomic, assign, readonly, getter = isConstant) BOOL constant;
+
+// The value sent by the receiver, if it is `constant`.
+@property (nonatomic, assign, readonly) RCLGeometry constantValue;
+
+// Whether the receiver skips values which are equal to the last value it sent
+// to the same subscriber.
+//
+// Values are compared before being boxed, so a skipped value costs no
+// allocations. A distinct signal is never fused into the signals which use it
+// as an operand, so that they see exactly the values that it sends.
+@property (nonatomic, assign, readonly, getter = isDistinct) BOOL distinct;
+
+// The largest difference in any component for which two values are considered
+// equal, if the receiver is `distinct`.
+@property (nonatomic, assign, readonly) CGFloat tolerance;
+
+// Creates a signal which sends a single value and completes, like
+// +[RACSignal return:].
+//
+// value  - The value to send. If this is of type RCLGeometryTypeNone, the
+//          signal will complete without sending anything.
+// object - The boxed form of `value`, to send to subscribers which are not
+//          geometry signals. If nil, `value` will be boxed as needed.
++ (instancetype)signalWithConstant:(RCLGeometry)value object:(id)object;
+
+// Creates a signal which, once all of `operands` have sent at least one value,
+// invokes `operation` whenever any of them sends a value.
+//
+// This behaves like +[RACSignal combineLatest:reduce:], and the operands will
+// be subscribed to in order, except that a signal which appears more than once
+// (directly, or among the operands of fused signals) is only subscribed to
+// once. Each of its values updates every position that it supplies, and then
+// results in a single invocation of `operation`, so no intermediate values are
+// sent. The returned signal completes when all of the operands have completed,
+// and errors as soon as any of them errors.
+//
+// operands  - The signals to combine. This must contain at least one signal.
+// operation - A pure function used to compute the values of the signal. If
+//             this returns a value of type RCLGeometryTypeNone, nothing will
+//             be sent for that update.
++ (instancetype)signalWithOperands:(NSArray *)operands operation:(RCLGeometryOperation)operation;
+
+// Like +signalWithOperands:operation:, but additionally combines signals which
+// are not expected to complete.
+//
+// auxiliaryOperands - Signals which are subscribed to before `operands`, and
+//                     whose latest values are passed to `operation` before
+//                     those of `operands`. The returned signal will complete
+//                     once all of `operands` have completed, regardless of
+//                     whether these have. This must not be nil.
++ (instancetype)signalWithOperands:(NSArray *)operands auxiliaryOperands:(NSArray *)auxiliaryOperands operation:(RCLGeometryOperation)operation;
+
+// Creates a signal which, once all of `operands` have sent at least one value,
+// sends the result of a reduction over their latest values whenever any of
+// them sends a value.
+//
+// The result is updated incrementally, so a value from one operand takes
+// O(log n) time to incorporate, regardless of the number of operands. To keep
+// this true, the returned signal is never fused with its operands, or with any
+// geometry signals which use it as an operand.
+//
+// Completion and errors behave as with +signalWithOperands:operation:.
+//
+// operands  - The signals to reduce. This must contain at least one signal.
+// reduction - The reduction to perform.
++ (instancetype)signalWithOperands:(NSArray *)operands reduction:(RCLGeometryReduction)reduction;
+
+// Creates signals which each send one result of an operation, once all of
+// `operands` have sent at least one value.
+//
+// The operation is evaluated once for each update, and its results are shared
+// by all of the returned signals. The operands are subscribed to when any of
+// the returned signals is first subscribed to, and disposed of once there are
+// no subscriptions to any of them. While subscribed, new subscribers are sent
+// the latest result right away.
+//
+// To avoid duplicating the operation, the returned signals are never fused
+// into the geometry signals which use them. Completion and errors behave as
+// with +signalWithOperands:operation:, and are sent to the subscribers of all
+// of the returned signals.
+//
+// operands          - The signals to combine. This must contain at least one
+//                     signal.
+// auxiliaryOperands - Signals which are not expected to complete, as with
+//                     +signalWithOperands:auxiliaryOperands:operation:. This
+//                     must not be nil.
+// count             - The number of results computed by `operation`. This
+//                     must not be zero.
+// operation         - A pure function used to compute the results.
+//
+// Returns an array of `count` signals, each of which sends the result at the
+// same index. If all of the operands are constant, so are the signals.
++ (NSArray *)signalsWithOperands:(NSArray *)operands auxiliaryOperands:(NSArray *)auxiliaryOperands count:(NSUInteger)count operation:(RCLGeometryMultipleOperation)operation;
+
+// Returns a `distinct` signal which evaluates the same operation or reduction
+// as the receiver.
+//
+// Evaluations which produce a value equal to the last one sent, to within
+// `tolerance`, are recorded by the profiler as suppressed.
+//
+// tolerance - The largest difference in any component for which two values
+//             should be considered equal. This must not be negative.
+//
+// Returns the receiver if it's `constant`.
+- (instancetype)distinctWithTolerance:(CGFloat)tolerance;
+
+// Subscribes to the receiver without boxing the values it sends.
+//
+// Returns a disposable which can be used to cancel the subscription.
+- (RACDisposable *)subscribeGeometry:(void (^)(RCLGeometry value))nextBlock error:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock;
+
+// Subscribes to the receiver's operands, but defers evaluating its operation
+// until the value is taken from the returned subscription.
+//
+// Operands which are themselves geometry signals are subscribed to lazily as
+// well, so upstream stages are evaluated on the thread which takes the value,
+// rather than the one which sent the inputs. The exceptions are `distinct`
+// signals, including the view geometry signals, which read their views where
+// the views change, and signals returned from
+// +signalsWithOperands:auxiliaryOperands:count:operation:, whose shared
+// evaluation always happens when their operands send.
+//
+// Completion is not reported. Layout transactions have no effect on lazy
+// subscriptions.
+//
+// invalidatedBlock - Invoked when the subscription becomes dirty, after every
+//                    operand has sent a value. This is not invoked again
+//                    until the value has been taken. This must not be nil.
+// errorBlock       - Invoked if any operand errors, after which the
+//                    subscription is disposed. This may be nil.
+//
+// Returns a subscription from which the value can be taken. The receiver must
+// not be `constant`.
+- (id<RCLLazyGeometrySubscription>)subscribeLazily:(void (^)(void))invalidatedBlock error:(void (^)(NSError *error))errorBlock;
+
+@end
@@ -0,0 +1,1525 @@
+//
+//  RCLGeometrySignal.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLGeometrySignal.h"
+#import "RACSignal+RCLAnimationAdditions.h"
+#import "RACSignal+RCLGeometryAdditions.h"
+#import "RCLGeometryKernels.h"
+#import "RCLProfiler+Private.h"
+#import <libkern/OSAtomic.h>
+#import <mach/mach_time.h>
+#import <ReactiveCocoa/EXTScope.h>
+
+RCLGeometry RCLGeometryFromObject(id object) {
+	if ([object isKindOfClass:NSNumber.class]) {
+		return RCLGeometryMakeNumber([object doubleValue]);
+	}
+
+	if (![object isKindOfClass:NSValue.class]) return RCLGeometryNone;
+
+	NSValue *value = object;
+	switch (value.med_geometryStructType) {
+		case MEDGeometryStructTypeRect:
+			return RCLGeometryMakeRect(value.med_rectValue);
+
+		case MEDGeometryStructTypePoint:
+			return RCLGeometryMakePoint(value.med_pointValue);
+
+		case MEDGeometryStructTypeSize:
+			return RCLGeometryMakeSize(value.med_sizeValue);
+
+		case MEDGeometryStructTypeEdgeInsets:
+			return RCLGeometryMakeEdgeInsets(value.med_edgeInsetsValue);
+
+		default:
+			return RCLGeometryNone;
+	}
+}
+
+id RCLGeometryBox(RCLGeometry value) {
+	if (value.type == RCLGeometryTypeNone) return nil;
+
+	if (RCLProfilerEnabled) OSAtomicIncrement64(&RCLProfilerBoxedValueCount);
+
+	switch (value.type) {
+		case RCLGeometryTypeNumber:
+			return @(value.number);
+
+		case RCLGeometryTypePoint:
+			return MEDBox(value.point);
+
+		case RCLGeometryTypeSize:
+			return MEDBox(value.size);
+
+		case RCLGeometryTypeRect:
+			return MEDBox(value.rect);
+
+		case RCLGeometryTypeEdgeInsets:
+			return MEDBox(value.insets);
+
+		case RCLGeometryTypeNone:
+			return nil;
+	}
+}
+
+BOOL RCLGeometryEqualToGeometry(RCLGeometry a, RCLGeometry b) {
+	if (a.type != b.type) return NO;
+
+	switch (a.type) {
+		case RCLGeometryTypeNumber:
+			return a.number == b.number;
+
+		case RCLGeometryTypePoint:
+			return CGPointEqualToPoint(a.point, b.point);
+
+		case RCLGeometryTypeSize:
+			return CGSizeEqualToSize(a.size, b.size);
+
+		case RCLGeometryTypeRect:
+			return CGRectEqualToRect(a.rect, b.rect);
+
+		case RCLGeometryTypeEdgeInsets:
+			return MEDEdgeInsetsEqualToEdgeInsets(a.insets, b.insets);
+
+		case RCLGeometryTypeNone:
+			return YES;
+	}
+}
+
+// Determines whether two components differ by no more than `tolerance`.
+static inline BOOL RCLComponentsWithinTolerance(CGFloat a, CGFloat b, CGFloat tolerance) {
+	// Checking for equality first handles infinite components.
+	return a == b || fabs(a - b) <= tolerance;
+}
+
+BOOL RCLGeometryEqualToGeometryWithTolerance(RCLGeometry a, RCLGeometry b, CGFloat tolerance) {
+	NSCParameterAssert(tolerance >= 0);
+
+	if (tolerance == 0) return RCLGeometryEqualToGeometry(a, b);
+	if (a.type != b.type) return NO;
+
+	switch (a.type) {
+		case RCLGeometryTypeNumber:
+			return RCLComponentsWithinTolerance(a.number, b.number, tolerance);
+
+		case RCLGeometryTypePoint:
+			return RCLComponentsWithinTolerance(a.point.x, b.point.x, tolerance)
+				&& RCLComponentsWithinTolerance(a.point.y, b.point.y, tolerance);
+
+		case RCLGeometryTypeSize:
+			return RCLComponentsWithinTolerance(a.size.width, b.size.width, tolerance)
+				&& RCLComponentsWithinTolerance(a.size.height, b.size.height, tolerance);
+
+		case RCLGeometryTypeRect:
+			return RCLComponentsWithinTolerance(a.rect.origin.x, b.rect.origin.x, tolerance)
+				&& RCLComponentsWithinTolerance(a.rect.origin.y, b.rect.origin.y, tolerance)
+				&& RCLComponentsWithinTolerance(a.rect.size.width, b.rect.size.width, tolerance)
+				&& RCLComponentsWithinTolerance(a.rect.size.height, b.rect.size.height, tolerance);
+
+		case RCLGeometryTypeEdgeInsets:
+			return RCLComponentsWithinTolerance(a.insets.top, b.insets.top, tolerance)
+				&& RCLComponentsWithinTolerance(a.insets.left, b.insets.left, tolerance)
+				&& RCLComponentsWithinTolerance(a.insets.bottom, b.insets.bottom, tolerance)
+				&& RCLComponentsWithinTolerance(a.insets.right, b.insets.right, tolerance);
+
+		case RCLGeometryTypeNone:
+			return YES;
+	}
+}
+
+// The maximum number of operands that a geometry signal may have for its
+// operands to be fused into it.
+#define RCLMaximumFusedOperands 8
+
+// Computes the result of a signal which other operations were fused into.
+//
+// values      - The latest value of each input of the signal.
+// innerValues - The last value of each operation which was fused into the
+//               signal, as remembered by one subscription. Values of type
+//               RCLGeometryTypeNone mean that no value has been produced yet.
+typedef RCLGeometry (^RCLGeometryFusedOperation)(const RCLGeometry *values, RCLGeometry *innerValues);
+
+// Describes how to compute the operands of an operation from the operands of
+// a fused signal.
+//
+// count            - The number of operands expected by the original
+//                    operation.
+// offsets          - For each original operand, the index of its first value
+//                    within the values of the fused signal.
+// operations       - For each original operand, the operation of the geometry
+//                    signal which was inlined in its place, or nil if the
+//                    operand was passed through unmodified, or was itself
+//                    fused. These are not retained by the table.
+// fusedOperations  - Like `operations`, but for operands which were
+//                    themselves fused.
+// innerOffsets     - For each operand in `fusedOperations`, the index of its
+//                    first inner value within those of the fused signal.
+//
+// The first `count` inner values of the fused signal hold the last value of
+// each inlined operation, in order.
+typedef struct {
+	NSUInteger count;
+	NSUInteger offsets[RCLMaximumFusedOperands];
+	__unsafe_unretained RCLGeometryOperation operations[RCLMaximumFusedOperands];
+	__unsafe_unretained RCLGeometryFusedOperation fusedOperations[RCLMaximumFusedOperands];
+	NSUInteger innerOffsets[RCLMaximumFusedOperands];
+} RCLFusionTable;
+
+// A subscription to an RCLGeometrySignal.
+//
+// All access to the instance variables must be synchronized on the
+// subscription.
+@interface RCLGeometrySubscription : NSObject <RCLLazyGeometrySubscription> {
+@public
+	// The latest value of each input of the signal.
+	RCLGeometry *_values;
+
+	// The inner values passed to the signal's `fusedOperation`, or NULL if it
+	// doesn't have one.
+	RCLGeometry *_innerValues;
+
+	// Whether each operand has sent a value yet.
+	BOOL *_hasValue;
+
+	// For a lazy subscription, whether each operand which is subscribed to
+	// lazily has become dirty since its value was last taken.
+	BOOL *_staleOperands;
+
+	// The number of operands which have neither sent a value, nor become
+	// dirty, yet.
+	NSUInteger _missingCount;
+
+	// The number of non-auxiliary operands which have not completed yet.
+	NSUInteger _activeCount;
+
+	// Whether an input has changed since the value of a lazy subscription was
+	// last taken.
+	BOOL _dirty;
+
+	// Whether the subscription is waiting to be evaluated at the end of the
+	// current layout transaction.
+	BOOL _pending;
+
+	// The order in which to evaluate the subscription at the end of a layout
+	// transaction, relative to other subscriptions.
+	//
+	// This starts as the depth of the signal, and is increased whenever the
+	// subscription is found to depend upon another through signals which the
+	// signal cannot see into.
+	NSUInteger _depth;
+
+	// Maintains the result of the signal's reduction, or NULL if the signal
+	// doesn't have one, or hasn't been evaluated yet.
+	RCLKernelReducer *_reducer;
+
+	// The type of the values given to `_reducer`.
+	RCLGeometryType _reducedType;
+
+	// The last value sent, if the signal is `distinct`, or a value of type
+	// RCLGeometryTypeNone if nothing has been sent yet.
+	RCLGeometry _lastValue;
+}
+
+// The signal which was subscribed to.
+@property (nonatomic, strong, readonly) RCLGeometrySignal *signal;
+
+// Disposes of the subscriptions to the operands of `signal`.
+@property (nonatomic, strong, readonly) RACCompoundDisposable *disposable;
+
+- (id)initWithSignal:(RCLGeometrySignal *)signal next:(void (^)(RCLGeometry value))nextBlock error:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock;
+
+// Initializes a subscription which marks itself dirty, instead of evaluating
+// the signal's operation, whenever an input changes.
+- (id)initWithSignal:(RCLGeometrySignal *)signal invalidated:(void (^)(void))invalidatedBlock error:(void (^)(NSError *error))errorBlock;
+
+// Records the latest value of an operand, then evaluates the signal's
+// operation if all operands have sent a value.
+- (void)receiveValue:(RCLGeometry)value fromOperandAtIndex:(NSUInteger)index;
+
+- (void)receiveError:(NSError *)error;
+
+// Completes the subscription if all non-auxiliary operands have completed.
+- (void)receiveCompleted;
+
+// Records that a lazy subscription to the operand at `index` has become dirty,
+// then marks the receiver dirty if every operand has a value.
+//
+// The operand's value is taken from `subscription` along with the receiver's
+// own.
+- (void)receiveInvalidationFromOperandAtIndex:(NSUInteger)index;
+
+// Stores the lazy subscription to the operand at `index`, once it has been
+// created.
+- (void)setLazySubscription:(id<RCLLazyGeometrySubscription>)subscription forOperandAtIndex:(NSUInteger)index;
+
+// Evaluates the signal's operation, if it was deferred by a layout
+// transaction.
+- (void)evaluatePendingUpdate;
+
+@end
+
+// Shares each evaluation of an RCLGeometryMultipleOperation between the
+// signals returned from +signalsWithOperands:auxiliaryOperands:count:operation:.
+//
+// The operands are subscribed to through a single connection, which is created
+// for the first subscriber to any result, and disposed of when the last one
+// goes away.
+@interface RCLGeometryMultiplexer : NSObject
+
+// The number of results computed by `operation`.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+- (id)initWithOperands:(NSArray *)operands auxiliaryOperands:(NSArray *)auxiliaryOperands count:(NSUInteger)count operation:(RCLGeometryMultipleOperation)operation;
+
+// Creates a signal which combines the operands of the receiver, and evaluates
+// its operation.
+//
+// results - The data to write the results into, which must have room for
+//           `count` values. The signal's own values only indicate that the
+//           results have been updated, and should be ignored.
+- (RCLGeometrySignal *)sourceSignalWithResults:(NSMutableData *)results;
+
+// Subscribes to the result at `index`, connecting to the operands if
+// necessary.
+//
+// Returns a disposable which can be used to cancel the subscription.
+- (RACDisposable *)subscribeToResultAtIndex:(NSUInteger)index next:(void (^)(RCLGeometry value))nextBlock error:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock;
+
+@end
+
+@interface RCLGeometrySignal ()
+
+// The multiplexer which evaluates the operation of the receiver, or nil if the
+// receiver evaluates its own.
+@property (nonatomic, strong, readonly) RCLGeometryMultiplexer *multiplexer;
+
+// The index of the result of `multiplexer` which the receiver sends.
+@property (nonatomic, assign, readonly) NSUInteger multiplexerIndex;
+
+// Creates a signal which sends the values of `operand` unchanged.
++ (instancetype)identitySignalWithOperand:(RCLGeometrySignal *)operand;
+
+// The operation which computes the values of the signal, or nil if the signal
+// has a `fusedOperation` or performs a `reduction` instead.
+@property (nonatomic, copy, readonly) RCLGeometryOperation operation;
+
+// The operation which computes the values of the signal, if other operations
+// were fused into it.
+//
+// An inlined operation which doesn't produce a value would not have sent
+// anything to the receiver if it had been subscribed to, so this uses the last
+// value it produced instead. Each subscription keeps those values separately.
+@property (nonatomic, copy, readonly) RCLGeometryFusedOperation fusedOperation;
+
+// The number of inner values used by `fusedOperation`.
+@property (nonatomic, assign, readonly) NSUInteger innerValueCount;
+
+// Whether the receiver has an `operation` or a `fusedOperation`.
+@property (nonatomic, assign, readonly, getter = isOperationSignal) BOOL operationSignal;
+
+// The reduction performed by the signal, if it is not an `operationSignal`.
+@property (nonatomic, assign, readonly) RCLGeometryReduction reduction;
+
+// The object sent to subscribers which are not geometry signals, if the
+// receiver is `constant` and was given one.
+@property (nonatomic, strong, readonly) id constantObject;
+
+// The signal supplying each value passed to `operation`, in order.
+//
+// A signal may appear more than once, if it was shared by several of the
+// signals fused into the receiver. Each of the `operands` is only subscribed
+// to once, however, so one change to a shared signal results in only one
+// evaluation of `operation`.
+@property (nonatomic, copy, readonly) NSArray *inputs;
+
+// The indexes of inputs which do not need to complete in order for the
+// receiver to complete.
+@property (nonatomic, copy, readonly) NSIndexSet *auxiliaryInputIndexes;
+
+// The indexes of operands which do not need to complete in order for the
+// receiver to complete.
+@property (nonatomic, copy, readonly) NSIndexSet *auxiliaryOperandIndexes;
+
+// For each of the `inputs`, the index of the operand which supplies its value,
+// as a C array of NSUIntegers.
+//
+// This is nil if `inputs` and `operands` are identical.
+@property (nonatomic, copy, readonly) NSData *inputOperandIndexes;
+
+// The length of the longest path through geometry signals which could not be
+// fused into the receiver.
+//
+// Layout transactions evaluate signals in order of increasing depth, so that
+// each signal is evaluated after all of the others that it depends upon.
+@property (nonatomic, assign, readonly) NSUInteger depth;
+
+// Initializes the receiver with the given operands, fusing any geometry
+// signals among them.
+//
+// If `operation` is nil, the operands are not fused, and the caller must set
+// up a `reduction` instead.
+- (id)initWithOperands:(NSArray *)operands auxiliaryIndexes:(NSIndexSet *)auxiliaryIndexes operation:(RCLGeometryOperation)operation;
+
+// Initializes the receiver to perform a reduction over the given operands.
+- (id)initWithOperands:(NSArray *)operands reduction:(RCLGeometryReduction)reduction;
+
+// Subscribes `subscription` to each of the receiver's operands.
+//
+// Returns the subscription's disposable.
+- (RACDisposable *)subscribeOperandsWithSubscription:(RCLGeometrySubscription *)subscription;
+
+@end
+
+#pragma mark Transactions
+
+// The number of layout transactions currently in progress on the main thread.
+static NSUInteger RCLLayoutTransactionLevel = 0;
+
+// Subscriptions awaiting evaluation at the end of the outermost transaction,
+// grouped by the depth of their signals.
+//
+// This must only be accessed from the main thread.
+static NSMutableArray *RCLPendingSubscriptions = nil;
+
+// The lowest depth in RCLPendingSubscriptions which has any subscriptions, or
+// NSNotFound if there are none.
+static NSUInteger RCLLowestPendingDepth = NSNotFound;
+
+// The pending subscription currently being evaluated, if any.
+static __unsafe_unretained RCLGeometrySubscription *RCLEvaluatingSubscription = nil;
+
+// Determines whether geometry signals should defer evaluation until the end of
+// the current layout transaction.
+//
+// Updates within an animated signal are never deferred, so that any layout
+// changes they trigger happen within the same animation.
+static BOOL RCLShouldDeferEvaluation(void) {
+	if (![NSThread isMainThread]) return NO;
+
+	return RCLLayoutTransactionLevel > 0 && !RCLIsInAnimatedSignal();
+}
+
+static void RCLEnqueuePendingSubscription(RCLGeometrySubscription *subscription) {
+	NSCAssert([NSThread isMainThread], @"Geometry signal evaluation can only be deferred on the main thread");
+
+	// Anything which becomes pending while another subscription is being
+	// evaluated must depend upon it, so evaluate it afterward (both now and in
+	// future transactions).
+	if (RCLEvaluatingSubscription != nil) {
+		subscription->_depth = MAX(subscription->_depth, RCLEvaluatingSubscription->_depth + 1);
+	}
+
+	NSUInteger depth = subscription->_depth;
+
+	if (RCLPendingSubscriptions == nil) RCLPendingSubscriptions = [[NSMutableArray alloc] init];
+	while (RCLPendingSubscriptions.count <= depth) {
+		[RCLPendingSubscriptions addObject:[NSMutableArray array]];
+	}
+
+	[RCLPendingSubscriptions[depth] addObject:subscription];
+
+	if (RCLLowestPendingDepth == NSNotFound || depth < RCLLowestPendingDepth) {
+		RCLLowestPendingDepth = depth;
+	}
+}
+
+// Evaluates pending subscriptions in order of depth, until none remain.
+//
+// Evaluating a subscription may cause others to become pending, so
+// RCLLowestPendingDepth is checked again after each one.
+static void RCLEvaluatePendingSubscriptions(void) {
+	while (RCLLowestPendingDepth != NSNotFound) {
+		NSUInteger depth = RCLLowestPendingDepth;
+		NSMutableArray *subscriptions = RCLPendingSubscriptions[depth];
+
+		RCLGeometrySubscription *subscription = subscriptions[0];
+		[subscriptions removeObjectAtIndex:0];
+
+		if (subscriptions.count == 0) {
+			RCLLowestPendingDepth = NSNotFound;
+
+			for (NSUInteger i = depth + 1; i < RCLPendingSubscriptions.count; i++) {
+				if ([RCLPendingSubscriptions[i] count] > 0) {
+					RCLLowestPendingDepth = i;
+					break;
+				}
+			}
+		}
+
+		RCLEvaluatingSubscription = subscription;
+		[subscription evaluatePendingUpdate];
+		RCLEvaluatingSubscription = nil;
+	}
+}
+
+void RCLPerformLayoutTransaction(void (^block)(void)) {
+	NSCParameterAssert(block != nil);
+
+	if (![NSThread isMainThread]) {
+		block();
+		return;
+	}
+
+	++RCLLayoutTransactionLevel;
+	@onExit {
+		NSCAssert(RCLLayoutTransactionLevel > 0, @"Unbalanced decrement of RCLLayoutTransactionLevel");
+		--RCLLayoutTransactionLevel;
+	};
+
+	block();
+
+	// Keep the transaction open while evaluating, so that any signals updated
+	// as a result are evaluated afterward, in the same pass.
+	if (RCLLayoutTransactionLevel == 1) RCLEvaluatePendingSubscriptions();
+}
+
+@implementation RCLGeometrySignal
+
+#pragma mark Lifecycle
+
++ (instancetype)signalWithOperands:(NSArray *)operands operation:(RCLGeometryOperation)operation {
+	return [self signalWithOperands:operands auxiliaryOperands:@[] operation:operation];
+}
+
++ (instancetype)signalWithOperands:(NSArray *)operands auxiliaryOperands:(NSArray *)auxiliaryOperands operation:(RCLGeometryOperation)operation {
+	NSCParameterAssert(operands.count > 0);
+	NSCParameterAssert(auxiliaryOperands != nil);
+	NSCParameterAssert(operation != nil);
+
+	NSArray *allOperands = [auxiliaryOperands arrayByAddingObjectsFromArray:operands];
+	NSIndexSet *auxiliaryIndexes = [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, auxiliaryOperands.count)];
+
+	return [[self alloc] initWithOperands:allOperands auxiliaryIndexes:auxiliaryIndexes operation:operation];
+}
+
++ (instancetype)signalWithOperands:(NSArray *)operands reduction:(RCLGeometryReduction)reduction {
+	NSCParameterAssert(operands.count > 0);
+
+	return [[self alloc] initWithOperands:operands reduction:reduction];
+}
+
++ (NSArray *)signalsWithOperands:(NSArray *)operands auxiliaryOperands:(NSArray *)auxiliaryOperands count:(NSUInteger)count operation:(RCLGeometryMultipleOperation)operation {
+	NSCParameterAssert(operands.count > 0);
+	NSCParameterAssert(auxiliaryOperands != nil);
+	NSCParameterAssert(count > 0);
+	NSCParameterAssert(operation != nil);
+
+	RCLGeometryMultiplexer *multiplexer = [[RCLGeometryMultiplexer alloc] initWithOperands:operands auxiliaryOperands:auxiliaryOperands count:count operation:operation];
+
+	// This is never subscribed to, but describes the stage that the
+	// multiplexer will create. If it's constant, the operation has already
+	// been evaluated into `constantResults`.
+	NSMutableData *constantResults = [NSMutableData dataWithLength:count * sizeof(RCLGeometry)];
+	RCLGeometrySignal *source = [multiplexer sourceSignalWithResults:constantResults];
+
+	NSMutableArray *signals = [NSMutableArray arrayWithCapacity:count];
+
+	for (NSUInteger i = 0; i < count; i++) {
+		RCLGeometrySignal *signal = nil;
+
+		if (source.constant) {
+			signal = [self signalWithConstant:((const RCLGeometry *)constantResults.bytes)[i] object:nil];
+		} else {
+			signal = [[self alloc] init];
+			signal->_multiplexer = multiplexer;
+			signal->_multiplexerIndex = i;
+			signal->_operands = source.operands;
+			signal->_depth = source.depth;
+		}
+
+		[signals addObject:signal];
+	}
+
+	return signals;
+}
+
++ (instancetype)signalWithConstant:(RCLGeometry)value object:(id)object {
+	RCLGeometrySignal *signal = [[self alloc] initWithOperands:@[] auxiliaryIndexes:[NSIndexSet indexSet] operation:^(const RCLGeometry *values) {
+		return value;
+	}];
+
+	signal->_constantObject = object;
+	return signal;
+}
+
+- (id)initWithOperands:(NSArray *)operands auxiliaryIndexes:(NSIndexSet *)auxiliaryIndexes operation:(RCLGeometryOperation)operation {
+	self = [super init];
+	if (self == nil) return nil;
+
+	NSUInteger count = operands.count;
+	BOOL canFuse = (operation != nil && count <= RCLMaximumFusedOperands);
+
+	NSMutableArray *fusedInputs = [NSMutableArray arrayWithCapacity:count];
+	NSMutableIndexSet *fusedAuxiliaryIndexes = [NSMutableIndexSet indexSet];
+
+	// Strong references to the operations in `table`.
+	NSMutableArray *innerOperations = [NSMutableArray array];
+	RCLFusionTable table = { .count = count };
+
+	// The first inner values are for the operations inlined by the receiver,
+	// and the rest for those inlined by its operands.
+	NSUInteger innerValueCount = count;
+
+	for (NSUInteger i = 0; i < count; i++) {
+		RACSignal *operand = operands[i];
+		BOOL auxiliary = [auxiliaryIndexes containsIndex:i];
+		NSUInteger offset = fusedInputs.count;
+
+		// Reductions are maintained incrementally by their own subscriptions,
+		// so they can't be inlined. Distinct signals need to remember what
+		// they last sent, so they can't be either.
+		if (canFuse && [operand isKindOfClass:RCLGeometrySignal.class] && [(RCLGeometrySignal *)operand isOperationSignal] && ![(RCLGeometrySignal *)operand isDistinct]) {
+			RCLGeometrySignal *inner = (id)operand;
+
+			[inner.auxiliaryInputIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+				[fusedAuxiliaryIndexes addIndex:offset + index];
+			}];
+
+			if (auxiliary) [fusedAuxiliaryIndexes addIndexesInRange:NSMakeRange(offset, inner.inputs.count)];
+
+			[fusedInputs addObjectsFromArray:inner.inputs];
+			table.offsets[i] = offset;
+
+			if (inner.fusedOperation != nil) {
+				[innerOperations addObject:inner.fusedOperation];
+
+				table.fusedOperations[i] = inner.fusedOperation;
+				table.innerOffsets[i] = innerValueCount;
+				innerValueCount += inner.innerValueCount;
+			} else {
+				[innerOperations addObject:inner.operation];
+				table.operations[i] = inner.operation;
+			}
+		} else {
+			if (auxiliary) [fusedAuxiliaryIndexes addIndex:offset];
+
+			[fusedInputs addObject:operand];
+
+			if (canFuse) table.offsets[i] = offset;
+		}
+	}
+
+	_inputs = [fusedInputs copy];
+	_auxiliaryInputIndexes = [fusedAuxiliaryIndexes copy];
+
+	// Only subscribe once to each distinct signal, so that every input it
+	// supplies is updated at the same time.
+	NSMutableArray *uniqueOperands = [NSMutableArray arrayWithCapacity:_inputs.count];
+	NSMutableIndexSet *requiredOperandIndexes = [NSMutableIndexSet indexSet];
+	NSMutableData *inputOperandIndexes = [NSMutableData dataWithLength:_inputs.count * sizeof(NSUInteger)];
+	NSUInteger *operandIndexes = inputOperandIndexes.mutableBytes;
+
+	for (NSUInteger i = 0; i < _inputs.count; i++) {
+		RACSignal *input = _inputs[i];
+
+		NSUInteger operandIndex = [uniqueOperands indexOfObjectIdenticalTo:input];
+		if (operandIndex == NSNotFound) {
+			operandIndex = uniqueOperands.count;
+			[uniqueOperands addObject:input];
+		}
+
+		operandIndexes[i] = operandIndex;
+
+		// A shared signal only needs to complete if any of the inputs it
+		// supplies are required to.
+		if (![_auxiliaryInputIndexes containsIndex:i]) [requiredOperandIndexes addIndex:operandIndex];
+	}
+
+	NSMutableIndexSet *auxiliaryOperandIndexes = [NSMutableIndexSet indexSetWithIndexesInRange:NSMakeRange(0, uniqueOperands.count)];
+	[auxiliaryOperandIndexes removeIndexes:requiredOperandIndexes];
+
+	_operands = [uniqueOperands copy];
+	_auxiliaryOperandIndexes = [auxiliaryOperandIndexes copy];
+
+	if (_operands.count < _inputs.count) _inputOperandIndexes = [inputOperandIndexes copy];
+
+	for (RACSignal *operand in _operands) {
+		if (![operand isKindOfClass:RCLGeometrySignal.class]) continue;
+
+		_depth = MAX(_depth, [(RCLGeometrySignal *)operand depth] + 1);
+	}
+
+	if (innerOperations.count == 0) {
+		_operation = [operation copy];
+	} else {
+		_innerValueCount = innerValueCount;
+		_fusedOperation = [^(const RCLGeometry *values, RCLGeometry *innerValues) {
+			// Keep the inlined operations alive, since the table doesn't.
+			(void)innerOperations;
+
+			RCLGeometry inputs[RCLMaximumFusedOperands];
+
+			for (NSUInteger i = 0; i < table.count; i++) {
+				__unsafe_unretained RCLGeometryOperation inner = table.operations[i];
+				__unsafe_unretained RCLGeometryFusedOperation fusedInner = table.fusedOperations[i];
+
+				RCLGeometry result;
+				if (inner != nil) {
+					result = inner(values + table.offsets[i]);
+				} else if (fusedInner != nil) {
+					result = fusedInner(values + table.offsets[i], innerValues + table.innerOffsets[i]);
+				} else {
+					inputs[i] = values[table.offsets[i]];
+					continue;
+				}
+
+				if (result.type != RCLGeometryTypeNone) {
+					innerValues[i] = result;
+				} else if (innerValues[i].type == RCLGeometryTypeNone) {
+					// Unfused, the operand wouldn't have sent anything yet.
+					return RCLGeometryNone;
+				}
+
+				inputs[i] = innerValues[i];
+			}
+
+			return operation(inputs);
+		} copy];
+	}
+
+	// With nothing to subscribe to, the result can never change, so compute it
+	// once and fold it into any signals which use the receiver.
+	if (self.operationSignal && _inputs.count == 0) {
+		RCLGeometry value;
+		if (_fusedOperation != nil) {
+			RCLGeometry *innerValues = calloc(_innerValueCount, sizeof(*innerValues));
+			value = _fusedOperation(NULL, innerValues);
+			free(innerValues);
+		} else {
+			value = _operation(NULL);
+		}
+
+		_constant = YES;
+		_constantValue = value;
+		_fusedOperation = nil;
+		_innerValueCount = 0;
+		_operation = [^(const RCLGeometry *values) {
+			return value;
+		} copy];
+	}
+
+	return self;
+}
+
+- (id)initWithOperands:(NSArray *)operands reduction:(RCLGeometryReduction)reduction {
+	self = [self initWithOperands:operands auxiliaryIndexes:[NSIndexSet indexSet] operation:nil];
+	if (self == nil) return nil;
+
+	_reduction = reduction;
+
+	return self;
+}
+
+#pragma mark Properties
+
+- (BOOL)isOperationSignal {
+	return self.operation != nil || self.fusedOperation != nil;
+}
+
+#pragma mark Distinct Values
+
+- (instancetype)distinctWithTolerance:(CGFloat)tolerance {
+	NSCParameterAssert(tolerance >= 0);
+
+	if (self.constant) return self;
+
+	// Multiplexed results are shared, so compare them in a separate stage.
+	if (self.multiplexer != nil) return [[self.class identitySignalWithOperand:self] distinctWithTolerance:tolerance];
+
+	RCLGeometrySignal *signal = [[self.class alloc] init];
+	signal->_operands = self.operands;
+	signal->_operation = self.operation;
+	signal->_fusedOperation = self.fusedOperation;
+	signal->_innerValueCount = self.innerValueCount;
+	signal->_reduction = self.reduction;
+	signal->_inputs = self.inputs;
+	signal->_auxiliaryInputIndexes = self.auxiliaryInputIndexes;
+	signal->_auxiliaryOperandIndexes = self.auxiliaryOperandIndexes;
+	signal->_inputOperandIndexes = self.inputOperandIndexes;
+	signal->_depth = self.depth;
+	signal->_distinct = YES;
+	signal->_tolerance = tolerance;
+
+	return signal;
+}
+
++ (instancetype)identitySignalWithOperand:(RCLGeometrySignal *)operand {
+	NSCParameterAssert(operand != nil);
+
+	return [self signalWithOperands:@[ operand ] operation:^(const RCLGeometry *values) {
+		return values[0];
+	}];
+}
+
+#pragma mark Stages
+
+- (NSUInteger)rcl_stageCount {
+	// Constants are never subscribed to by other geometry signals.
+	if (self.constant) return 0;
+
+	NSUInteger count = 1;
+
+	for (RACSignal *operand in self.operands) {
+		count += operand.rcl_stageCount;
+	}
+
+	return count;
+}
+
+#pragma mark Subscription
+
+- (RACDisposable *)subscribe:(id<RACSubscriber>)subscriber {
+	NSCParameterAssert(subscriber != nil);
+
+	if (self.constant) {
+		// Behave just like +[RACSignal return:].
+		return [RACScheduler.subscriptionScheduler schedule:^{
+			id object = self.constantObject ?: RCLGeometryBox(self.constantValue);
+			if (object != nil) [subscriber sendNext:object];
+
+			[subscriber sendCompleted];
+		}];
+	}
+
+	// Let RACDynamicSignal take care of the subscriber bookkeeping. Values are
+	// boxed here, and only here.
+	return [[RACSignal createSignal:^(id<RACSubscriber> boxingSubscriber) {
+		return [self subscribeGeometry:^(RCLGeometry value) {
+			[boxingSubscriber sendNext:RCLGeometryBox(value)];
+		} error:^(NSError *error) {
+			[boxingSubscriber sendError:error];
+		} completed:^{
+			[boxingSubscriber sendCompleted];
+		}];
+	}] subscribe:subscriber];
+}
+
+- (RACDisposable *)subscribeGeometry:(void (^)(RCLGeometry value))nextBlock error:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock {
+	NSCParameterAssert(nextBlock != nil);
+
+	if (self.constant) {
+		if (self.constantValue.type != RCLGeometryTypeNone) nextBlock(self.constantValue);
+		if (completedBlock != nil) completedBlock();
+
+		return nil;
+	}
+
+	if (self.multiplexer != nil) {
+		return [self.multiplexer subscribeToResultAtIndex:self.multiplexerIndex next:nextBlock error:errorBlock completed:completedBlock];
+	}
+
+	RCLGeometrySubscription *subscription = [[RCLGeometrySubscription alloc] initWithSignal:self next:nextBlock error:errorBlock completed:completedBlock];
+	return [self subscribeOperandsWithSubscription:subscription];
+}
+
+- (id<RCLLazyGeometrySubscription>)subscribeLazily:(void (^)(void))invalidatedBlock error:(void (^)(NSError *error))errorBlock {
+	NSCParameterAssert(invalidatedBlock != nil);
+	NSCAssert(!self.constant, @"%@ is constant, and cannot be subscribed to lazily", self);
+
+	// The shared evaluation is eager, so only the result is taken lazily.
+	if (self.multiplexer != nil) return [[self.class identitySignalWithOperand:self] subscribeLazily:invalidatedBlock error:errorBlock];
+
+	RCLGeometrySubscription *subscription = [[RCLGeometrySubscription alloc] initWithSignal:self invalidated:invalidatedBlock error:errorBlock];
+	[self subscribeOperandsWithSubscription:subscription];
+
+	return subscription;
+}
+
+- (RACDisposable *)subscribeOperandsWithSubscription:(RCLGeometrySubscription *)subscription {
+	RACCompoundDisposable *disposable = subscription.disposable;
+
+	NSIndexSet *auxiliaryIndexes = self.auxiliaryOperandIndexes;
+
+	[self.operands enumerateObjectsUsingBlock:^(RACSignal *operand, NSUInteger index, BOOL *stop) {
+		RACDisposable *operandDisposable = nil;
+
+		void (^receiveError)(NSError *) = ^(NSError *error) {
+			[subscription receiveError:error];
+		};
+
+		// Auxiliary operands don't count toward completion.
+		void (^receiveCompleted)(void) = ^{};
+		if (![auxiliaryIndexes containsIndex:index]) {
+			receiveCompleted = ^{
+				[subscription receiveCompleted];
+			};
+		}
+
+		// Lazy subscriptions propagate their laziness upstream, so that
+		// earlier stages are also evaluated when the value is taken, instead
+		// of on the thread which sent their inputs.
+		//
+		// Distinct stages are still evaluated eagerly. They exist to stop
+		// unchanged values where they're sent, and they're how the view
+		// geometry signals read view properties, which must happen on the
+		// thread that changed the view.
+		if (subscription.invalidatedBlock != nil && [operand isKindOfClass:RCLGeometrySignal.class] && !((RCLGeometrySignal *)operand).constant && !((RCLGeometrySignal *)operand).distinct) {
+			id<RCLLazyGeometrySubscription> operandSubscription = [(RCLGeometrySignal *)operand subscribeLazily:^{
+				[subscription receiveInvalidationFromOperandAtIndex:index];
+			} error:receiveError];
+
+			[subscription setLazySubscription:operandSubscription forOperandAtIndex:index];
+			operandDisposable = [RACDisposable disposableWithBlock:^{
+				[operandSubscription dispose];
+			}];
+		} else if ([operand isKindOfClass:RCLGeometrySignal.class]) {
+			operandDisposable = [(RCLGeometrySignal *)operand subscribeGeometry:^(RCLGeometry value) {
+				[subscription receiveValue:value fromOperandAtIndex:index];
+			} error:receiveError completed:receiveCompleted];
+		} else {
+			operandDisposable = [operand subscribeNext:^(id x) {
+				[subscription receiveValue:RCLGeometryFromObject(x) fromOperandAtIndex:index];
+			} error:receiveError completed:receiveCompleted];
+		}
+
+		if (operandDisposable != nil) [disposable addDisposable:operandDisposable];
+
+		// Stop subscribing if an operand terminated the signal synchronously.
+		*stop = disposable.disposed;
+	}];
+
+	return disposable;
+}
+
+@end
+
+@interface RCLGeometrySubscription () {
+	// The number of inputs of the signal.
+	NSUInteger _inputCount;
+
+	// For each input, the index of the operand which supplies its value, or
+	// NULL if each input is supplied by the operand at the same index.
+	//
+	// This points into the signal's `inputOperandIndexes`.
+	const NSUInteger *_inputOperandIndexes;
+}
+
+@property (nonatomic, copy, readonly) void (^nextBlock)(RCLGeometry value);
+@property (nonatomic, copy, readonly) void (^errorBlock)(NSError *error);
+@property (nonatomic, copy, readonly) void (^completedBlock)(void);
+
+// Invoked when a lazy subscription becomes dirty, or nil if the receiver
+// evaluates its signal's operation eagerly.
+@property (nonatomic, copy, readonly) void (^invalidatedBlock)(void);
+
+// For a lazy subscription, the lazy subscription to each operand, or NSNull
+// for operands which are subscribed to eagerly.
+@property (nonatomic, strong, readonly) NSMutableArray *lazyOperandSubscriptions;
+
+// Stores the latest value of an operand into the inputs which it supplies.
+//
+// This must be invoked while synchronized on the receiver.
+- (void)storeValue:(RCLGeometry)value fromOperandAtIndex:(NSUInteger)index;
+
+// Evaluates the signal's operation, and sends the result.
+//
+// This must be invoked while synchronized on the receiver.
+- (void)evaluate;
+
+// Like -computeDistinctResultSuppressed:, but records the evaluation with the
+// profiler, if it's enabled.
+//
+// This must be invoked while synchronized on the receiver.
+- (RCLGeometry)computeProfiledResult;
+
+// Like -computeResult, but returns a value of type RCLGeometryTypeNone if the
+// signal is `distinct`, and the result is equal to the last value sent.
+//
+// suppressed - If not NULL, this will be set to whether the result was
+//              suppressed for being equal to the last value sent.
+//
+// This must be invoked while synchronized on the receiver.
+- (RCLGeometry)computeDistinctResultSuppressed:(BOOL *)suppressed;
+
+// Computes the result of the signal's operation or reduction, from the latest
+// values of its inputs.
+//
+// This must be invoked while synchronized on the receiver.
+- (RCLGeometry)computeResult;
+
+// Stores the latest value of an input into `_reducer`.
+//
+// This must be invoked while synchronized on the receiver.
+- (void)reduceInputAtIndex:(NSUInteger)index;
+
+@end
+
+@implementation RCLGeometrySubscription
+
+#pragma mark Lifecycle
+
+- (id)initWithSignal:(RCLGeometrySignal *)signal next:(void (^)(RCLGeometry value))nextBlock error:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock {
+	NSCParameterAssert(signal != nil);
+	NSCParameterAssert(nextBlock != nil);
+
+	NSUInteger count = signal.operands.count;
+	NSUInteger auxiliaryCount = signal.auxiliaryOperandIndexes.count;
+	NSCAssert(count > auxiliaryCount, @"%@ must have at least one non-auxiliary operand", signal);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_signal = signal;
+	_disposable = [RACCompoundDisposable compoundDisposable];
+	_nextBlock = [nextBlock copy];
+	_errorBlock = [errorBlock copy];
+	_completedBlock = [completedBlock copy];
+
+	_inputCount = signal.inputs.count;
+	_inputOperandIndexes = signal.inputOperandIndexes.bytes;
+
+	_values = calloc(_inputCount, sizeof(*_values));
+	if (signal.fusedOperation != nil) _innerValues = calloc(signal.innerValueCount, sizeof(*_innerValues));
+	_hasValue = calloc(count, sizeof(*_hasValue));
+	_missingCount = count;
+	_activeCount = count - auxiliaryCount;
+	_depth = signal.depth;
+
+	return self;
+}
+
+- (id)initWithSignal:(RCLGeometrySignal *)signal invalidated:(void (^)(void))invalidatedBlock error:(void (^)(NSError *error))errorBlock {
+	NSCParameterAssert(invalidatedBlock != nil);
+
+	self = [self initWithSignal:signal next:^(RCLGeometry value) {} error:errorBlock completed:nil];
+	if (self == nil) return nil;
+
+	_invalidatedBlock = [invalidatedBlock copy];
+	_staleOperands = calloc(signal.operands.count, sizeof(*_staleOperands));
+
+	_lazyOperandSubscriptions = [NSMutableArray arrayWithCapacity:signal.operands.count];
+	for (NSUInteger i = 0; i < signal.operands.count; i++) {
+		[_lazyOperandSubscriptions addObject:NSNull.null];
+	}
+
+	return self;
+}
+
+- (void)dealloc {
+	free(_values);
+	free(_innerValues);
+	free(_hasValue);
+	free(_staleOperands);
+	RCLKernelReducerFree(_reducer);
+}
+
+#pragma mark Events
+
+- (void)receiveValue:(RCLGeometry)value fromOperandAtIndex:(NSUInteger)index {
+	@synchronized (self) {
+		if (self.disposable.disposed) return;
+
+		[self storeValue:value fromOperandAtIndex:index];
+		if (_missingCount > 0) return;
+
+		if (self.invalidatedBlock != nil) {
+			if (_dirty) return;
+
+			_dirty = YES;
+			self.invalidatedBlock();
+			return;
+		}
+
+		if (RCLShouldDeferEvaluation()) {
+			if (!_pending) {
+				_pending = YES;
+				RCLEnqueuePendingSubscription(self);
+			}
+
+			return;
+		}
+
+		[self evaluate];
+	}
+}
+
+- (void)receiveInvalidationFromOperandAtIndex:(NSUInteger)index {
+	@synchronized (self) {
+		if (self.disposable.disposed) return;
+		if (_staleOperands[index]) return;
+
+		_staleOperands[index] = YES;
+		if (!_hasValue[index]) _missingCount--;
+
+		if (_missingCount > 0 || _dirty) return;
+
+		_dirty = YES;
+		self.invalidatedBlock();
+	}
+}
+
+- (void)setLazySubscription:(id<RCLLazyGeometrySubscription>)subscription forOperandAtIndex:(NSUInteger)index {
+	NSCParameterAssert(subscription != nil);
+
+	@synchronized (self) {
+		self.lazyOperandSubscriptions[index] = subscription;
+
+		// If the receiver's value was taken while the operand was still being
+		// subscribed to, the operand's value was left behind, and the operand
+		// won't invalidate the receiver again until it's taken.
+		if (!_staleOperands[index] || _missingCount > 0 || _dirty) return;
+
+		_dirty = YES;
+		self.invalidatedBlock();
+	}
+}
+
+- (void)receiveError:(NSError *)error {
+	@synchronized (self) {
+		if (self.disposable.disposed) return;
+
+		_pending = NO;
+		[self.disposable dispose];
+	}
+
+	if (self.errorBlock != nil) self.errorBlock(error);
+}
+
+- (void)receiveCompleted {
+	@synchronized (self) {
+		if (self.disposable.disposed) return;
+		if (--_activeCount > 0) return;
+
+		// Send any deferred value before completing.
+		if (_pending) {
+			_pending = NO;
+			[self evaluate];
+		}
+
+		[self.disposable dispose];
+	}
+
+	if (self.completedBlock != nil) self.completedBlock();
+}
+
+- (void)evaluatePendingUpdate {
+	@synchronized (self) {
+		if (!_pending) return;
+		_pending = NO;
+
+		if (self.disposable.disposed) return;
+
+		[self evaluate];
+	}
+}
+
+#pragma mark RCLLazyGeometrySubscription
+
+- (BOOL)isDirty {
+	@synchronized (self) {
+		return _dirty;
+	}
+}
+
+- (RCLGeometry)takeDirtyValue {
+	NSMutableIndexSet *staleIndexes = [NSMutableIndexSet indexSet];
+	NSMutableArray *staleSubscriptions = [NSMutableArray array];
+
+	@synchronized (self) {
+		if (!_dirty) return RCLGeometryNone;
+		_dirty = NO;
+
+		NSArray *lazySubscriptions = self.lazyOperandSubscriptions;
+		for (NSUInteger index = 0; index < lazySubscriptions.count; index++) {
+			id subscription = lazySubscriptions[index];
+			if (!_staleOperands[index] || subscription == NSNull.null) continue;
+
+			_staleOperands[index] = NO;
+			if (!_hasValue[index]) _missingCount++;
+
+			[staleIndexes addIndex:index];
+			[staleSubscriptions addObject:subscription];
+		}
+	}
+
+	// Operands invalidate the receiver while synchronized on themselves, so
+	// their values must be taken outside of the receiver's lock.
+	NSUInteger staleCount = staleSubscriptions.count;
+	RCLGeometry *operandValues = malloc(MAX(staleCount, 1) * sizeof(*operandValues));
+	for (NSUInteger i = 0; i < staleCount; i++) {
+		operandValues[i] = [staleSubscriptions[i] takeDirtyValue];
+	}
+
+	@synchronized (self) {
+		NSUInteger index = staleIndexes.firstIndex;
+		for (NSUInteger i = 0; i < staleCount; i++, index = [staleIndexes indexGreaterThanIndex:index]) {
+			// Nothing is taken from a distinct operand whose value hasn't
+			// changed.
+			if (operandValues[i].type != RCLGeometryTypeNone) [self storeValue:operandValues[i] fromOperandAtIndex:index];
+		}
+
+		free(operandValues);
+
+		if (_missingCount > 0) return RCLGeometryNone;
+		return [self computeProfiledResult];
+	}
+}
+
+- (void)dispose {
+	[self.disposable dispose];
+}
+
+#pragma mark Evaluation
+
+- (void)storeValue:(RCLGeometry)value fromOperandAtIndex:(NSUInteger)index {
+	if (_inputOperandIndexes == NULL) {
+		_values[index] = value;
+		if (_reducer != NULL) [self reduceInputAtIndex:index];
+	} else {
+		for (NSUInteger i = 0; i < _inputCount; i++) {
+			if (_inputOperandIndexes[i] != index) continue;
+
+			_values[i] = value;
+			if (_reducer != NULL) [self reduceInputAtIndex:i];
+		}
+	}
+
+	if (!_hasValue[index]) {
+		_hasValue[index] = YES;
+		if (_staleOperands == NULL || !_staleOperands[index]) _missingCount--;
+	}
+}
+
+- (void)evaluate {
+	RCLGeometry result = [self computeProfiledResult];
+	if (result.type != RCLGeometryTypeNone) self.nextBlock(result);
+}
+
+- (RCLGeometry)computeProfiledResult {
+	if (!RCLProfilerEnabled) return [self computeDistinctResultSuppressed:NULL];
+
+	BOOL suppressed = NO;
+	uint64_t startTime = mach_absolute_time();
+	RCLGeometry result = [self computeDistinctResultSuppressed:&suppressed];
+	uint64_t duration = mach_absolute_time() - startTime;
+
+	RCLProfilerOutcome outcome = RCLProfilerOutcomeSent;
+	if (suppressed) {
+		outcome = RCLProfilerOutcomeSuppressed;
+	} else if (result.type == RCLGeometryTypeNone) {
+		outcome = RCLProfilerOutcomeEmpty;
+	}
+
+	[RCLProfiler.sharedProfiler recordEvaluationOfSignal:self.signal duration:duration outcome:outcome];
+
+	return result;
+}
+
+- (RCLGeometry)computeDistinctResultSuppressed:(BOOL *)suppressed {
+	RCLGeometry result = [self computeResult];
+
+	RCLGeometrySignal *signal = self.signal;
+	if (!signal.distinct || result.type == RCLGeometryTypeNone) return result;
+
+	if (RCLGeometryEqualToGeometryWithTolerance(result, _lastValue, signal.tolerance)) {
+		if (suppressed != NULL) *suppressed = YES;
+		return RCLGeometryNone;
+	}
+
+	_lastValue = result;
+	return result;
+}
+
+- (RCLGeometry)computeResult {
+	RCLGeometrySignal *signal = self.signal;
+	if (signal.fusedOperation != nil) return signal.fusedOperation(_values, _innerValues);
+	if (signal.operation != nil) return signal.operation(_values);
+
+	RCLGeometryReduction reduction = signal.reduction;
+	BOOL extreme = (reduction == RCLGeometryReductionMinimum || reduction == RCLGeometryReductionMaximum);
+
+	// The reducer is only created once every input has a value, so that the
+	// type of the values is known.
+	if (_reducer == NULL) {
+		RCLKernelReduction kernelReduction = RCLKernelReductionSum;
+		size_t componentCount = 1;
+
+		if (extreme) {
+			kernelReduction = (reduction == RCLGeometryReductionMinimum ? RCLKernelReductionMinimum : RCLKernelReductionMaximum);
+			_reducedType = RCLGeometryTypeNumber;
+		} else {
+			_reducedType = _values[0].type;
+
+			switch (_reducedType) {
+				case RCLGeometryTypeNumber:
+					break;
+
+				case RCLGeometryTypePoint:
+				case RCLGeometryTypeSize:
+					componentCount = 2;
+					break;
+
+				default:
+					NSCAssert(NO, @"Values must contain numbers, CGSizes, or CGPoints: %@", RCLGeometryBox(_values[0]));
+					return RCLGeometryNone;
+			}
+		}
+
+		_reducer = RCLKernelReducerCreate(kernelReduction, _inputCount, componentCount);
+		if (_reducer == NULL) return RCLGeometryNone;
+
+		for (NSUInteger i = 0; i < _inputCount; i++) {
+			[self reduceInputAtIndex:i];
+		}
+	}
+
+	if (extreme && RCLKernelReducerValueCount(_reducer) == 0) return RCLGeometryNone;
+
+	CGFloat components[2];
+	RCLKernelReducerGetResult(_reducer, components);
+
+	switch (_reducedType) {
+		case RCLGeometryTypeNumber:
+			return RCLGeometryMakeNumber(components[0]);
+
+		case RCLGeometryTypePoint:
+			return RCLGeometryMakePoint(CGPointMake(components[0], components[1]));
+
+		case RCLGeometryTypeSize:
+			return RCLGeometryMakeSize(CGSizeMake(components[0], components[1]));
+
+		default:
+			return RCLGeometryNone;
+	}
+}
+
+- (void)reduceInputAtIndex:(NSUInteger)index {
+	RCLGeometry value = _values[index];
+
+	if (value.type != _reducedType) {
+		// Minimums and maximums skip anything that isn't a number.
+		NSCAssert(self.signal.reduction == RCLGeometryReductionMinimum || self.signal.reduction == RCLGeometryReductionMaximum, @"Values do not contain the same type of geometry structure: %@, %@", RCLGeometryBox(_values[0]), RCLGeometryBox(value));
+
+		RCLKernelReducerRemoveValue(_reducer, index);
+		return;
+	}
+
+	// Differences are computed by adding the negation of every value after
+	// the first.
+	CGFloat sign = (self.signal.reduction == RCLGeometryReductionDifference && index > 0 ? -1 : 1);
+	CGFloat components[2];
+
+	switch (value.type) {
+		case RCLGeometryTypeNumber:
+			components[0] = sign * value.number;
+			break;
+
+		case RCLGeometryTypePoint:
+			components[0] = sign * value.point.x;
+			components[1] = sign * value.point.y;
+			break;
+
+		case RCLGeometryTypeSize:
+			components[0] = sign * value.size.width;
+			components[1] = sign * value.size.height;
+			break;
+
+		default:
+			return;
+	}
+
+	RCLKernelReducerSetValue(_reducer, index, components);
+}
+
+@end
+
+// A subscriber to one result of an RCLGeometryMultiplexer.
+@interface RCLGeometryMultiplexerOutput : NSObject
+
+// The index of the result to send.
+@property (nonatomic, assign) NSUInteger index;
+
+@property (nonatomic, copy) void (^nextBlock)(RCLGeometry value);
+@property (nonatomic, copy) void (^errorBlock)(NSError *error);
+@property (nonatomic, copy) void (^completedBlock)(void);
+
+@end
+
+@implementation RCLGeometryMultiplexerOutput
+@end
+
+@interface RCLGeometryMultiplexer () {
+	// The latest results sent over `connection`, if `_hasLatestResults` is YES.
+	//
+	// This must only be accessed while synchronized on the receiver.
+	RCLGeometry *_latestResults;
+	BOOL _hasLatestResults;
+}
+
+@property (nonatomic, copy, readonly) NSArray *operands;
+@property (nonatomic, copy, readonly) NSArray *auxiliaryOperands;
+@property (nonatomic, copy, readonly) RCLGeometryMultipleOperation operation;
+
+// The RCLGeometryMultiplexerOutputs currently attached to the receiver.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMutableArray *outputs;
+
+// The subscription to the operands, or nil if the receiver is not connected.
+//
+// Results from any other subscription are stale, and are ignored.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong) RACSerialDisposable *connection;
+
+// Detaches `output`, disconnecting from the operands if it was the last one.
+- (void)detachOutput:(RCLGeometryMultiplexerOutput *)output;
+
+@end
+
+@implementation RCLGeometryMultiplexer
+
+#pragma mark Lifecycle
+
+- (id)initWithOperands:(NSArray *)operands auxiliaryOperands:(NSArray *)auxiliaryOperands count:(NSUInteger)count operation:(RCLGeometryMultipleOperation)operation {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_operands = [operands copy];
+	_auxiliaryOperands = [auxiliaryOperands copy];
+	_count = count;
+	_operation = [operation copy];
+	_outputs = [NSMutableArray array];
+	_latestResults = calloc(count, sizeof(*_latestResults));
+
+	return self;
+}
+
+- (void)dealloc {
+	free(_latestResults);
+}
+
+#pragma mark Evaluation
+
+- (RCLGeometrySignal *)sourceSignalWithResults:(NSMutableData *)results {
+	NSCParameterAssert(results.length >= self.count * sizeof(RCLGeometry));
+
+	RCLGeometryMultipleOperation operation = self.operation;
+	NSUInteger count = self.count;
+
+	return [RCLGeometrySignal signalWithOperands:self.operands auxiliaryOperands:self.auxiliaryOperands operation:^(const RCLGeometry *values) {
+		RCLGeometry *resultValues = results.mutableBytes;
+		for (NSUInteger i = 0; i < count; i++) {
+			resultValues[i] = RCLGeometryNone;
+		}
+
+		operation(values, resultValues);
+
+		// Any value will do, as long as something is sent.
+		return RCLGeometryMakeNumber(0);
+	}];
+}
+
+#pragma mark Subscription
+
+- (RACDisposable *)subscribeToResultAtIndex:(NSUInteger)index next:(void (^)(RCLGeometry value))nextBlock error:(void (^)(NSError *error))errorBlock completed:(void (^)(void))completedBlock {
+	NSCParameterAssert(index < self.count);
+	NSCParameterAssert(nextBlock != nil);
+
+	RCLGeometryMultiplexerOutput *output = [[RCLGeometryMultiplexerOutput alloc] init];
+	output.index = index;
+	output.nextBlock = nextBlock;
+	output.errorBlock = errorBlock;
+	output.completedBlock = completedBlock;
+
+	RACSerialDisposable *connection = nil;
+
+	// Like RACReplaySubject, results are sent while synchronized, so that the
+	// latest results can't be replayed after a newer update to the same
+	// output.
+	@synchronized (self) {
+		[self.outputs addObject:output];
+
+		if (self.connection == nil) {
+			connection = [[RACSerialDisposable alloc] init];
+			self.connection = connection;
+		} else if (_hasLatestResults) {
+			RCLGeometry latestResult = _latestResults[index];
+			if (latestResult.type != RCLGeometryTypeNone) nextBlock(latestResult);
+		}
+	}
+
+	RACDisposable *detachDisposable = [RACDisposable disposableWithBlock:^{
+		[self detachOutput:output];
+	}];
+
+	if (connection == nil) return detachDisposable;
+
+	// Each subscription to the source writes into its own results, so a
+	// stale connection can't overwrite those of the current one.
+	NSMutableData *results = [NSMutableData dataWithLength:self.count * sizeof(RCLGeometry)];
+	RCLGeometrySignal *sourceSignal = [self sourceSignalWithResults:results];
+
+	// Returns the outputs to send an event to, or nil if `connection` is
+	// stale.
+	//
+	// This must be invoked while synchronized on the receiver. Outputs may
+	// detach while the event is being sent, so they're copied first.
+	NSArray * (^outputsForEvent)(BOOL) = ^ NSArray * (BOOL terminating) {
+		if (self.connection != connection) return nil;
+
+		NSArray *outputs = [self.outputs copy];
+		if (terminating) {
+			[self.outputs removeAllObjects];
+			self.connection = nil;
+			_hasLatestResults = NO;
+		} else {
+			memcpy(_latestResults, results.bytes, self.count * sizeof(*_latestResults));
+			_hasLatestResults = YES;
+		}
+
+		return outputs;
+	};
+
+	// This may deliver the first results synchronously, to the output
+	// attached above.
+	connection.disposable = [sourceSignal subscribeGeometry:^(RCLGeometry value) {
+		@synchronized (self) {
+			const RCLGeometry *resultValues = results.bytes;
+
+			for (RCLGeometryMultiplexerOutput *output in outputsForEvent(NO)) {
+				RCLGeometry result = resultValues[output.index];
+				if (result.type != RCLGeometryTypeNone) output.nextBlock(result);
+			}
+		}
+	} error:^(NSError *error) {
+		@synchronized (self) {
+			for (RCLGeometryMultiplexerOutput *output in outputsForEvent(YES)) {
+				if (output.errorBlock != nil) output.errorBlock(error);
+			}
+		}
+	} completed:^{
+		@synchronized (self) {
+			for (RCLGeometryMultiplexerOutput *output in outputsForEvent(YES)) {
+				if (output.completedBlock != nil) output.completedBlock();
+			}
+		}
+	}];
+
+	return detachDisposable;
+}
+
+- (void)detachOutput:(RCLGeometryMultiplexerOutput *)output {
+	RACSerialDisposable *connection = nil;
+
+	@synchronized (self) {
+		NSUInteger index = [self.outputs indexOfObjectIdenticalTo:output];
+		if (index == NSNotFound) return;
+
+		[self.outputs removeObjectAtIndex:index];
+		if (self.outputs.count > 0) return;
+
+		connection = self.connection;
+		self.connection = nil;
+		_hasLatestResults = NO;
+	}
+
+	[connection dispose];
+}
+
+@end
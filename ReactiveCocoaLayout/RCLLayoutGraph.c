@@ -0,0 +1,663 @@
+//
+//  RCLLayoutGraph.c
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#include "RCLLayoutGraph.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct RCLLayoutGraph {
+	// The number of nodes, and the number which can be stored before the
+	// per-node arrays need to grow.
+	size_t count;
+	size_t capacity;
+
+	// For each node, the function which computes it, or NULL for a source.
+	RCLLayoutFunction *functions;
+	void **contexts;
+
+	// For each node, the index of its first input within `inputs`, and the
+	// number of inputs it has.
+	size_t *inputOffsets;
+	size_t *inputCounts;
+
+	// The inputs of every node, one after another.
+	RCLLayoutNode *inputs;
+	size_t inputsCount;
+	size_t inputsCapacity;
+
+	// The largest number of inputs of any node.
+	size_t maxInputCount;
+
+	// For each source node, its latest rectangle.
+	RCLRect *sourceRects;
+
+	// For each node, its rectangle as of the last evaluation.
+	RCLRect *committedRects;
+
+	// For each node, its rectangle as computed by the evaluation in progress.
+	// This is swapped with `committedRects` once evaluation finishes.
+	RCLRect *pendingRects;
+
+	// For each node, whether it has been added or changed since the last
+	// evaluation.
+	bool *dirty;
+
+	// A disjoint-set forest over the nodes, where each tree is a component.
+	size_t *parents;
+	size_t *ranks;
+
+	// The number of trees in `parents`.
+	size_t componentCount;
+
+	// Threads which help evaluate the graph. These are started as needed by
+	// RCLLayoutGraphEvaluate(), then kept until the graph is destroyed, so
+	// that evaluation doesn't pay for creating threads.
+	struct RCLLayoutPoolThread **poolThreads;
+	size_t poolThreadCount;
+
+	// Protects the fields below, which hand evaluations to `poolThreads`.
+	pthread_mutex_t poolLock;
+
+	// Signaled when `generation` changes, or `stopping` is set.
+	pthread_cond_t poolWork;
+
+	// Signaled when `busyCount` reaches 0.
+	pthread_cond_t poolIdle;
+
+	// The evaluation in progress, or NULL.
+	struct RCLLayoutEvaluation *evaluation;
+
+	// Incremented for each evaluation given to `poolThreads`.
+	uint64_t generation;
+
+	// The number of pool threads which haven't finished the current
+	// evaluation.
+	size_t busyCount;
+
+	// Whether the pool threads should exit.
+	bool stopping;
+};
+
+// Grows `*array` to hold `capacity` elements of `size` bytes.
+//
+// Returns whether memory could be allocated. If not, `*array` is unchanged.
+static bool RCLGrowArray(void **array, size_t capacity, size_t size) {
+	void *grown = realloc(*array, capacity * size);
+	if (grown == NULL) return false;
+
+	*array = grown;
+	return true;
+}
+
+// Ensures that the per-node arrays can hold at least one more node.
+static bool RCLLayoutGraphReserveNode(RCLLayoutGraph *graph) {
+	if (graph->count < graph->capacity) return true;
+
+	size_t capacity = (graph->capacity == 0 ? 64 : graph->capacity * 2);
+
+	// Each array is grown separately, so a failure part way through leaves
+	// some larger than necessary, which is harmless.
+	if (!RCLGrowArray((void **)&graph->functions, capacity, sizeof(*graph->functions))) return false;
+	if (!RCLGrowArray((void **)&graph->contexts, capacity, sizeof(*graph->contexts))) return false;
+	if (!RCLGrowArray((void **)&graph->inputOffsets, capacity, sizeof(*graph->inputOffsets))) return false;
+	if (!RCLGrowArray((void **)&graph->inputCounts, capacity, sizeof(*graph->inputCounts))) return false;
+	if (!RCLGrowArray((void **)&graph->sourceRects, capacity, sizeof(*graph->sourceRects))) return false;
+	if (!RCLGrowArray((void **)&graph->committedRects, capacity, sizeof(*graph->committedRects))) return false;
+	if (!RCLGrowArray((void **)&graph->pendingRects, capacity, sizeof(*graph->pendingRects))) return false;
+	if (!RCLGrowArray((void **)&graph->dirty, capacity, sizeof(*graph->dirty))) return false;
+	if (!RCLGrowArray((void **)&graph->parents, capacity, sizeof(*graph->parents))) return false;
+	if (!RCLGrowArray((void **)&graph->ranks, capacity, sizeof(*graph->ranks))) return false;
+
+	graph->capacity = capacity;
+	return true;
+}
+
+// Finds the root of the tree containing `node`, compressing the path to it.
+static size_t RCLLayoutGraphFindComponent(size_t *parents, size_t node) {
+	size_t root = node;
+	while (parents[root] != root) root = parents[root];
+
+	while (parents[node] != root) {
+		size_t parent = parents[node];
+		parents[node] = root;
+		node = parent;
+	}
+
+	return root;
+}
+
+// Merges the components containing two nodes.
+static void RCLLayoutGraphUnionComponents(RCLLayoutGraph *graph, size_t a, size_t b) {
+	size_t rootA = RCLLayoutGraphFindComponent(graph->parents, a);
+	size_t rootB = RCLLayoutGraphFindComponent(graph->parents, b);
+	if (rootA == rootB) return;
+
+	if (graph->ranks[rootA] < graph->ranks[rootB]) {
+		size_t swap = rootA;
+		rootA = rootB;
+		rootB = swap;
+	}
+
+	graph->parents[rootB] = rootA;
+	if (graph->ranks[rootA] == graph->ranks[rootB]) graph->ranks[rootA]++;
+
+	graph->componentCount--;
+}
+
+// Adds a node without any inputs, and returns its index.
+static RCLLayoutNode RCLLayoutGraphAppendNode(RCLLayoutGraph *graph, RCLLayoutFunction function, void *context, RCLRect sourceRect) {
+	RCLLayoutNode node = graph->count++;
+
+	graph->functions[node] = function;
+	graph->contexts[node] = context;
+	graph->inputOffsets[node] = graph->inputsCount;
+	graph->inputCounts[node] = 0;
+	graph->sourceRects[node] = sourceRect;
+	graph->committedRects[node] = RCLRectNull;
+	graph->dirty[node] = true;
+	graph->parents[node] = node;
+	graph->ranks[node] = 0;
+
+	graph->componentCount++;
+	return node;
+}
+
+RCLLayoutGraph *RCLLayoutGraphCreate(void) {
+	RCLLayoutGraph *graph = calloc(1, sizeof(RCLLayoutGraph));
+	if (graph == NULL) return NULL;
+
+	if (pthread_mutex_init(&graph->poolLock, NULL) != 0) goto failedLock;
+	if (pthread_cond_init(&graph->poolWork, NULL) != 0) goto failedWork;
+	if (pthread_cond_init(&graph->poolIdle, NULL) != 0) goto failedIdle;
+
+	return graph;
+
+failedIdle:
+	pthread_cond_destroy(&graph->poolWork);
+failedWork:
+	pthread_mutex_destroy(&graph->poolLock);
+failedLock:
+	free(graph);
+	return NULL;
+}
+
+static void RCLLayoutGraphStopPool(RCLLayoutGraph *graph);
+
+void RCLLayoutGraphFree(RCLLayoutGraph *graph) {
+	if (graph == NULL) return;
+
+	RCLLayoutGraphStopPool(graph);
+	pthread_cond_destroy(&graph->poolIdle);
+	pthread_cond_destroy(&graph->poolWork);
+	pthread_mutex_destroy(&graph->poolLock);
+
+	free(graph->functions);
+	free(graph->contexts);
+	free(graph->inputOffsets);
+	free(graph->inputCounts);
+	free(graph->inputs);
+	free(graph->sourceRects);
+	free(graph->committedRects);
+	free(graph->pendingRects);
+	free(graph->dirty);
+	free(graph->parents);
+	free(graph->ranks);
+	free(graph);
+}
+
+size_t RCLLayoutGraphNodeCount(const RCLLayoutGraph *graph) {
+	assert(graph != NULL);
+
+	return graph->count;
+}
+
+size_t RCLLayoutGraphComponentCount(const RCLLayoutGraph *graph) {
+	assert(graph != NULL);
+
+	return graph->componentCount;
+}
+
+RCLLayoutNode RCLLayoutGraphAddSource(RCLLayoutGraph *graph, RCLRect rect) {
+	assert(graph != NULL);
+
+	if (!RCLLayoutGraphReserveNode(graph)) return RCLLayoutNodeNotFound;
+
+	return RCLLayoutGraphAppendNode(graph, NULL, NULL, rect);
+}
+
+RCLLayoutNode RCLLayoutGraphAddNode(RCLLayoutGraph *graph, const RCLLayoutNode *inputs, size_t inputCount, RCLLayoutFunction function, void *context) {
+	assert(graph != NULL);
+	assert(inputs != NULL || inputCount == 0);
+	assert(function != NULL);
+
+	if (!RCLLayoutGraphReserveNode(graph)) return RCLLayoutNodeNotFound;
+
+	if (graph->inputsCount + inputCount > graph->inputsCapacity) {
+		size_t capacity = (graph->inputsCapacity == 0 ? 64 : graph->inputsCapacity * 2);
+		while (capacity < graph->inputsCount + inputCount) capacity *= 2;
+
+		if (!RCLGrowArray((void **)&graph->inputs, capacity, sizeof(*graph->inputs))) return RCLLayoutNodeNotFound;
+		graph->inputsCapacity = capacity;
+	}
+
+	RCLLayoutNode node = RCLLayoutGraphAppendNode(graph, function, context, RCLRectNull);
+
+	for (size_t i = 0; i < inputCount; i++) {
+		assert(inputs[i] < node);
+
+		graph->inputs[graph->inputsCount++] = inputs[i];
+		RCLLayoutGraphUnionComponents(graph, node, inputs[i]);
+	}
+
+	graph->inputCounts[node] = inputCount;
+	if (inputCount > graph->maxInputCount) graph->maxInputCount = inputCount;
+
+	return node;
+}
+
+void RCLLayoutGraphSetSourceRect(RCLLayoutGraph *graph, RCLLayoutNode source, RCLRect rect) {
+	assert(graph != NULL);
+	assert(source < graph->count);
+	assert(graph->functions[source] == NULL);
+
+	graph->sourceRects[source] = rect;
+	graph->dirty[source] = true;
+}
+
+RCLRect RCLLayoutGraphGetRect(const RCLLayoutGraph *graph, RCLLayoutNode node) {
+	assert(graph != NULL);
+	assert(node < graph->count);
+
+	return graph->committedRects[node];
+}
+
+// A double-ended queue of components, owned by one worker.
+//
+// The owner takes components from the back, while other workers steal them
+// from the front, so that thieves take the work that the owner would reach
+// last.
+typedef struct {
+	pthread_mutex_t lock;
+
+	// The indexes of the components in the queue are `components[head]`
+	// through `components[tail - 1]`.
+	size_t *components;
+	size_t head;
+	size_t tail;
+} RCLLayoutDeque;
+
+// The state shared by all of the workers in one evaluation.
+typedef struct RCLLayoutEvaluation {
+	const RCLLayoutGraph *graph;
+
+	// The nodes of every component to evaluate, grouped by component, and in
+	// ascending order within each component. Because inputs always come
+	// before the nodes which use them, this is a valid evaluation order.
+	const size_t *componentNodes;
+
+	// For each component, the index of its first node within
+	// `componentNodes`, followed by one past the end of the last component.
+	const size_t *componentOffsets;
+
+	RCLLayoutDeque *deques;
+	size_t workerCount;
+} RCLLayoutEvaluation;
+
+// A thread in the pool of a graph, and the arguments to
+// RCLLayoutPoolThreadMain().
+typedef struct RCLLayoutPoolThread {
+	pthread_t thread;
+	RCLLayoutGraph *graph;
+
+	// The index of the worker which this thread acts as. The calling thread
+	// of RCLLayoutGraphEvaluate() is always worker 0.
+	size_t workerIndex;
+
+	// The `generation` of the graph as of the last evaluation this thread
+	// took part in, or when it was started.
+	uint64_t generation;
+} RCLLayoutPoolThread;
+
+// Takes a component from the back of a deque.
+static bool RCLLayoutDequePopBack(RCLLayoutDeque *deque, size_t *component) {
+	pthread_mutex_lock(&deque->lock);
+
+	bool found = (deque->head < deque->tail);
+	if (found) *component = deque->components[--deque->tail];
+
+	pthread_mutex_unlock(&deque->lock);
+	return found;
+}
+
+// Takes a component from the front of a deque.
+static bool RCLLayoutDequePopFront(RCLLayoutDeque *deque, size_t *component) {
+	pthread_mutex_lock(&deque->lock);
+
+	bool found = (deque->head < deque->tail);
+	if (found) *component = deque->components[deque->head++];
+
+	pthread_mutex_unlock(&deque->lock);
+	return found;
+}
+
+// Evaluates every node of one component into `pendingRects`.
+//
+// scratch - Storage for at least `maxInputCount` rectangles.
+static void RCLLayoutEvaluateComponent(const RCLLayoutEvaluation *evaluation, size_t component, RCLRect *scratch) {
+	const RCLLayoutGraph *graph = evaluation->graph;
+	RCLRect *rects = graph->pendingRects;
+
+	for (size_t i = evaluation->componentOffsets[component]; i < evaluation->componentOffsets[component + 1]; i++) {
+		size_t node = evaluation->componentNodes[i];
+
+		RCLLayoutFunction function = graph->functions[node];
+		if (function == NULL) {
+			rects[node] = graph->sourceRects[node];
+			continue;
+		}
+
+		// Inputs always belong to the same component, so they were computed
+		// by this thread, earlier in this loop.
+		const RCLLayoutNode *inputs = graph->inputs + graph->inputOffsets[node];
+		size_t inputCount = graph->inputCounts[node];
+
+		for (size_t j = 0; j < inputCount; j++) {
+			scratch[j] = rects[inputs[j]];
+		}
+
+		rects[node] = function(scratch, inputCount, graph->contexts[node]);
+	}
+}
+
+// Evaluates components from the worker's own deque, then steals from the
+// others until all of them are empty.
+//
+// No components are added once evaluation starts, so finding every deque empty
+// means that there's nothing left to do.
+static void RCLLayoutWorkerRun(RCLLayoutEvaluation *evaluation, size_t index) {
+	size_t maxInputCount = evaluation->graph->maxInputCount;
+	RCLRect *scratch = malloc(sizeof(*scratch) * (maxInputCount > 0 ? maxInputCount : 1));
+
+	// Treat a failure here as a reason to stop early. Other workers will steal
+	// anything left behind.
+	if (scratch == NULL) return;
+
+	size_t component = 0;
+
+	while (true) {
+		if (RCLLayoutDequePopBack(&evaluation->deques[index], &component)) {
+			RCLLayoutEvaluateComponent(evaluation, component, scratch);
+			continue;
+		}
+
+		bool stole = false;
+		for (size_t offset = 1; offset < evaluation->workerCount && !stole; offset++) {
+			size_t victim = (index + offset) % evaluation->workerCount;
+			stole = RCLLayoutDequePopFront(&evaluation->deques[victim], &component);
+		}
+
+		if (!stole) break;
+
+		RCLLayoutEvaluateComponent(evaluation, component, scratch);
+	}
+
+	free(scratch);
+}
+
+// Waits for each evaluation of the graph, and takes part in it if there are
+// enough workers, until the pool is stopped.
+static void *RCLLayoutPoolThreadMain(void *argument) {
+	RCLLayoutPoolThread *poolThread = argument;
+	RCLLayoutGraph *graph = poolThread->graph;
+
+	pthread_mutex_lock(&graph->poolLock);
+
+	while (true) {
+		while (graph->generation == poolThread->generation && !graph->stopping) {
+			pthread_cond_wait(&graph->poolWork, &graph->poolLock);
+		}
+
+		if (graph->stopping) break;
+
+		poolThread->generation = graph->generation;
+		RCLLayoutEvaluation *evaluation = graph->evaluation;
+		pthread_mutex_unlock(&graph->poolLock);
+
+		if (poolThread->workerIndex < evaluation->workerCount) RCLLayoutWorkerRun(evaluation, poolThread->workerIndex);
+
+		pthread_mutex_lock(&graph->poolLock);
+		if (--graph->busyCount == 0) pthread_cond_signal(&graph->poolIdle);
+	}
+
+	pthread_mutex_unlock(&graph->poolLock);
+	return NULL;
+}
+
+// Starts pool threads until there are enough to act as `workerCount - 1`
+// workers, alongside the calling thread.
+//
+// Pool threads are only added while no evaluation is in progress. If a thread
+// can't be started, the pool is left smaller, and the calling thread steals
+// the components of the missing workers.
+static void RCLLayoutGraphGrowPool(RCLLayoutGraph *graph, size_t workerCount) {
+	if (graph->poolThreadCount + 1 >= workerCount) return;
+
+	if (!RCLGrowArray((void **)&graph->poolThreads, workerCount - 1, sizeof(*graph->poolThreads))) return;
+
+	while (graph->poolThreadCount + 1 < workerCount) {
+		RCLLayoutPoolThread *poolThread = malloc(sizeof(*poolThread));
+		if (poolThread == NULL) return;
+
+		poolThread->graph = graph;
+		poolThread->workerIndex = graph->poolThreadCount + 1;
+
+		// The thread may not start waiting until after the next evaluation
+		// has begun, so it mustn't decide for itself which one is next.
+		poolThread->generation = graph->generation;
+
+		if (pthread_create(&poolThread->thread, NULL, RCLLayoutPoolThreadMain, poolThread) != 0) {
+			free(poolThread);
+			return;
+		}
+
+		graph->poolThreads[graph->poolThreadCount++] = poolThread;
+	}
+}
+
+// Tells every pool thread to exit, and waits for them to do so.
+static void RCLLayoutGraphStopPool(RCLLayoutGraph *graph) {
+	pthread_mutex_lock(&graph->poolLock);
+	graph->stopping = true;
+	pthread_cond_broadcast(&graph->poolWork);
+	pthread_mutex_unlock(&graph->poolLock);
+
+	for (size_t i = 0; i < graph->poolThreadCount; i++) {
+		pthread_join(graph->poolThreads[i]->thread, NULL);
+		free(graph->poolThreads[i]);
+	}
+
+	free(graph->poolThreads);
+	graph->poolThreads = NULL;
+	graph->poolThreadCount = 0;
+}
+
+// Groups the dirty components' nodes together, in evaluation order.
+//
+// On success, `*componentNodes` and `*componentOffsets` must be freed by the
+// caller.
+//
+// Returns the number of dirty components, or SIZE_MAX if memory could not be
+// allocated.
+static size_t RCLLayoutGraphCollectDirtyComponents(RCLLayoutGraph *graph, size_t **componentNodes, size_t **componentOffsets) {
+	size_t count = graph->count;
+
+	// For each root, the index of its component among the dirty ones, or
+	// SIZE_MAX if the component is clean.
+	size_t *indexes = malloc(sizeof(*indexes) * count);
+	size_t *roots = malloc(sizeof(*roots) * count);
+	size_t *offsets = NULL;
+	size_t *nodes = NULL;
+
+	if (indexes == NULL || roots == NULL) goto failed;
+
+	for (size_t node = 0; node < count; node++) {
+		indexes[node] = SIZE_MAX;
+		roots[node] = RCLLayoutGraphFindComponent(graph->parents, node);
+	}
+
+	size_t dirtyCount = 0;
+	for (size_t node = 0; node < count; node++) {
+		size_t root = roots[node];
+		if (graph->dirty[node] && indexes[root] == SIZE_MAX) indexes[root] = dirtyCount++;
+	}
+
+	offsets = calloc(dirtyCount + 1, sizeof(*offsets));
+	if (offsets == NULL) goto failed;
+
+	// Count the nodes of each component, then convert the counts into
+	// offsets, and place each node.
+	size_t nodeCount = 0;
+	for (size_t node = 0; node < count; node++) {
+		size_t index = indexes[roots[node]];
+		if (index == SIZE_MAX) continue;
+
+		offsets[index + 1]++;
+		nodeCount++;
+	}
+
+	for (size_t index = 0; index < dirtyCount; index++) {
+		offsets[index + 1] += offsets[index];
+	}
+
+	nodes = malloc(sizeof(*nodes) * (nodeCount > 0 ? nodeCount : 1));
+	if (nodes == NULL) goto failed;
+
+	// Reuse `roots` to track where the next node of each component goes.
+	size_t *next = roots;
+	for (size_t node = 0; node < count; node++) {
+		size_t index = indexes[next[node]];
+		next[node] = index;
+	}
+
+	size_t *cursors = indexes;
+	memcpy(cursors, offsets, sizeof(*offsets) * dirtyCount);
+
+	for (size_t node = 0; node < count; node++) {
+		size_t index = next[node];
+		if (index == SIZE_MAX) continue;
+
+		nodes[cursors[index]++] = node;
+	}
+
+	free(indexes);
+	free(roots);
+
+	*componentNodes = nodes;
+	*componentOffsets = offsets;
+	return dirtyCount;
+
+failed:
+	free(indexes);
+	free(roots);
+	free(offsets);
+	free(nodes);
+	return SIZE_MAX;
+}
+
+bool RCLLayoutGraphEvaluate(RCLLayoutGraph *graph, unsigned threadCount) {
+	assert(graph != NULL);
+
+	if (graph->count == 0) return true;
+
+	size_t *componentNodes = NULL;
+	size_t *componentOffsets = NULL;
+	size_t dirtyCount = RCLLayoutGraphCollectDirtyComponents(graph, &componentNodes, &componentOffsets);
+	if (dirtyCount == SIZE_MAX) return false;
+
+	size_t workerCount = (threadCount > 1 ? threadCount : 1);
+	if (workerCount > dirtyCount) workerCount = (dirtyCount > 0 ? dirtyCount : 1);
+
+	RCLLayoutDeque *deques = calloc(workerCount, sizeof(*deques));
+	size_t *dequeComponents = malloc(sizeof(*dequeComponents) * (dirtyCount > 0 ? dirtyCount : 1));
+
+	bool succeeded = (deques != NULL && dequeComponents != NULL);
+	if (!succeeded) goto cleanup;
+
+	RCLLayoutEvaluation evaluation = {
+		.graph = graph,
+		.componentNodes = componentNodes,
+		.componentOffsets = componentOffsets,
+		.deques = deques,
+		.workerCount = workerCount,
+	};
+
+	// Clean components keep their last results.
+	memcpy(graph->pendingRects, graph->committedRects, sizeof(*graph->pendingRects) * graph->count);
+
+	// Deal the components out to the workers in contiguous runs. Each deque
+	// gets a slice of `dequeComponents`.
+	for (size_t index = 0; index < dirtyCount; index++) {
+		dequeComponents[index] = index;
+	}
+
+	for (size_t i = 0; i < workerCount; i++) {
+		pthread_mutex_init(&deques[i].lock, NULL);
+		deques[i].components = dequeComponents;
+		deques[i].head = dirtyCount * i / workerCount;
+		deques[i].tail = dirtyCount * (i + 1) / workerCount;
+	}
+
+	// The calling thread acts as the first worker, and the pool threads as the
+	// rest. If the pool is smaller than requested, the workers which exist
+	// steal the components of those which don't.
+	RCLLayoutGraphGrowPool(graph, workerCount);
+
+	pthread_mutex_lock(&graph->poolLock);
+	graph->evaluation = &evaluation;
+	graph->busyCount = graph->poolThreadCount;
+	graph->generation++;
+	pthread_cond_broadcast(&graph->poolWork);
+	pthread_mutex_unlock(&graph->poolLock);
+
+	RCLLayoutWorkerRun(&evaluation, 0);
+
+	pthread_mutex_lock(&graph->poolLock);
+	while (graph->busyCount > 0) {
+		pthread_cond_wait(&graph->poolIdle, &graph->poolLock);
+	}
+
+	graph->evaluation = NULL;
+	pthread_mutex_unlock(&graph->poolLock);
+
+	for (size_t i = 0; i < workerCount; i++) {
+		// Every component must have been taken, unless even the calling
+		// thread failed to allocate its scratch space.
+		if (deques[i].head < deques[i].tail) succeeded = false;
+
+		pthread_mutex_destroy(&deques[i].lock);
+	}
+
+	if (succeeded) {
+		RCLRect *committedRects = graph->pendingRects;
+		graph->pendingRects = graph->committedRects;
+		graph->committedRects = committedRects;
+
+		memset(graph->dirty, 0, sizeof(*graph->dirty) * graph->count);
+	}
+
+cleanup:
+	free(deques);
+	free(dequeComponents);
+	free(componentNodes);
+	free(componentOffsets);
+
+	return succeeded;
+}
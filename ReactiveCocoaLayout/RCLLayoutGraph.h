@@ -0,0 +1,119 @@
+//
+//  RCLLayoutGraph.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#ifndef RCL_LAYOUT_GRAPH_H
+#define RCL_LAYOUT_GRAPH_H
+
+#include "RCLGeometryCore.h"
+
+// A graph of rectangles which depend upon each other, and which can be
+// evaluated across several threads.
+//
+// Each node is either a source, whose rectangle is set directly, or is computed
+// by a function of the rectangles of earlier nodes. Nodes which do not depend
+// upon each other, even indirectly, belong to separate components. Components
+// are evaluated concurrently by a pool of threads, which steal components from
+// each other as they run out of work. Each graph starts its pool threads the
+// first time they're needed, and keeps them until it's destroyed.
+//
+// Results are committed atomically. RCLLayoutGraphGetRect() always returns the
+// results of the last complete evaluation, never a mix of two.
+//
+// Like the rest of the geometry core, this has no dependency upon Apple
+// frameworks. A graph is not thread-safe, and must only be used from one
+// thread at a time.
+//
+// Nothing in the framework uses this yet, so it's only built into the
+// standalone geometry core library by the Makefile, and not into the framework
+// targets.
+
+// A graph of rectangles.
+typedef struct RCLLayoutGraph RCLLayoutGraph;
+
+// Identifies a node within a graph.
+//
+// Nodes are numbered consecutively from 0, in the order they were added.
+typedef size_t RCLLayoutNode;
+
+// Returned in place of a node which could not be added.
+#define RCLLayoutNodeNotFound ((RCLLayoutNode)-1)
+
+// Computes the rectangle of a node.
+//
+// This may be invoked on any thread, concurrently with the functions of nodes
+// in other components, so it must not have side effects.
+//
+// inputs     - The rectangles of the node's inputs, in the order given to
+//              RCLLayoutGraphAddNode().
+// inputCount - The number of inputs.
+// context    - The context given to RCLLayoutGraphAddNode().
+typedef RCLRect (*RCLLayoutFunction)(const RCLRect *inputs, size_t inputCount, void *context);
+
+// Creates an empty graph.
+//
+// Returns a new graph, which must be destroyed with RCLLayoutGraphFree(), or
+// NULL if memory could not be allocated.
+RCLLayoutGraph *RCLLayoutGraphCreate(void);
+
+// Destroys a graph created with RCLLayoutGraphCreate(), after waiting for its
+// pool threads to exit.
+void RCLLayoutGraphFree(RCLLayoutGraph *graph);
+
+// Returns the number of nodes in the graph.
+size_t RCLLayoutGraphNodeCount(const RCLLayoutGraph *graph);
+
+// Returns the number of independent components in the graph.
+size_t RCLLayoutGraphComponentCount(const RCLLayoutGraph *graph);
+
+// Adds a node whose rectangle is set directly.
+//
+// rect - The initial rectangle of the node.
+//
+// Returns the new node, or RCLLayoutNodeNotFound if memory could not be
+// allocated.
+RCLLayoutNode RCLLayoutGraphAddSource(RCLLayoutGraph *graph, RCLRect rect);
+
+// Adds a node whose rectangle is computed from those of other nodes.
+//
+// Because inputs must already exist, the graph can never contain a cycle.
+//
+// inputs     - The nodes whose rectangles are passed to `function`. Each of
+//              these must already be in the graph.
+// inputCount - The number of inputs. This may be 0.
+// function   - Computes the rectangle of the node. This must not be NULL.
+// context    - Passed to `function` when it's invoked. This is not retained.
+//
+// Returns the new node, or RCLLayoutNodeNotFound if memory could not be
+// allocated.
+RCLLayoutNode RCLLayoutGraphAddNode(RCLLayoutGraph *graph, const RCLLayoutNode *inputs, size_t inputCount, RCLLayoutFunction function, void *context);
+
+// Changes the rectangle of a source node.
+//
+// The new rectangle, and the rectangles of all nodes in the same component,
+// will be returned by RCLLayoutGraphGetRect() after the next evaluation.
+void RCLLayoutGraphSetSourceRect(RCLLayoutGraph *graph, RCLLayoutNode source, RCLRect rect);
+
+// Evaluates every component with a changed or added node, then commits the
+// results of all components at once.
+//
+// Components which have not changed since the last evaluation are skipped.
+//
+// threadCount - The number of threads to evaluate with, including the calling
+//               thread. If this is 0 or 1, evaluation happens serially on the
+//               calling thread. The result is the same in either case. Pool
+//               threads are started if the graph doesn't have enough yet.
+//
+// Returns whether evaluation succeeded. If memory could not be allocated,
+// nothing is committed, and false is returned.
+bool RCLLayoutGraphEvaluate(RCLLayoutGraph *graph, unsigned threadCount);
+
+// Returns the rectangle of `node` as of the last evaluation, or RCLRectNull if
+// the node has not been evaluated yet.
+RCLRect RCLLayoutGraphGetRect(const RCLLayoutGraph *graph, RCLLayoutNode node);
+
+#endif
@@ -0,0 +1,55 @@
+//
+//  RCLLayoutPlan.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLMacros.h"
+
+// A bitmask of RCLAttributes, where the bit `1 << attribute` is set for each
+// attribute that is present.
+typedef uint32_t RCLAttributeMask;
+
+// Returns the name of the `rcl_` key corresponding to the given attribute.
+NSString *NSStringFromRCLAttribute(RCLAttribute attribute);
+
+// Describes how to compute a rect from a particular set of layout attributes,
+// in a single evaluation.
+//
+// Plans are created once for each distinct set of attributes, then reused by
+// every binding with that shape (e.g., all of the cells in a table view). Each
+// binding only needs to supply its own signals.
+//
+// Plans are immutable, and can be used from any thread.
+@interface RCLLayoutPlan : NSObject
+
+// Returns the plan for the given attributes, creating it the first time that
+// the set of attributes is seen.
+//
+// attributes - The attributes which will be bound. This must not be zero.
++ (instancetype)planForAttributes:(RCLAttributeMask)attributes;
+
+// The attributes that the receiver applies.
+@property (nonatomic, assign, readonly) RCLAttributeMask attributes;
+
+// Creates a signal of rects that applies each of the receiver's attributes, in
+// the order described for RCLFrame.
+//
+// signals               - The signal to bind each of the receiver's attributes
+//                         to, keyed by RCLAttribute. For RCLAttributeBaseline,
+//                         this must be a signal of views. This must contain an
+//                         entry for every attribute of the receiver.
+// intrinsicBoundsSignal - The rects to lay out, if the receiver does not
+//                         include RCLAttributeRect. This is only used, and
+//                         must only be non-nil, in that case.
+// baselineSignal        - The baselines of the view being laid out. This is
+//                         only used if the receiver includes
+//                         RCLAttributeBaseline, and must not be nil in that
+//                         case.
+//
+// Returns a signal of CGRects.
+- (RACSignal *)rectSignalWithSignals:(NSDictionary *)signals intrinsicBoundsSignal:(RACSignal *)intrinsicBoundsSignal baselineSignal:(RACSignal *)baselineSignal;
+
+@end
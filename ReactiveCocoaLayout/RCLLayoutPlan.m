@@ -0,0 +1,315 @@
+//
+//  RCLLayoutPlan.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLLayoutPlan.h"
+#import "RACSignal+RCLWritingDirectionAdditions.h"
+#import "RCLGeometryCore.h"
+#import "RCLGeometrySignal.h"
+#import "RCLSignalNaming.h"
+
+#ifdef RCL_FOR_IPHONE
+#import "UIView+RCLGeometryAdditions.h"
+#else
+#import "NSView+RCLGeometryAdditions.h"
+#endif
+
+// The number of RCLAttributes which can be part of a plan.
+#define RCL_ATTRIBUTE_COUNT (RCLAttributeBaseline + 1)
+
+NSString *NSStringFromRCLAttribute(RCLAttribute attribute) {
+	switch (attribute) {
+		case RCLAttributeRect: return @"rcl_rect";
+		case RCLAttributeSize: return @"rcl_size";
+		case RCLAttributeOrigin: return @"rcl_origin";
+		case RCLAttributeHeight: return @"rcl_height";
+		case RCLAttributeWidth: return @"rcl_width";
+		case RCLAttributeCenter: return @"rcl_center";
+		case RCLAttributeCenterX: return @"rcl_centerX";
+		case RCLAttributeCenterY: return @"rcl_centerY";
+		case RCLAttributeBottom: return @"rcl_bottom";
+		case RCLAttributeRight: return @"rcl_right";
+		case RCLAttributeTop: return @"rcl_top";
+		case RCLAttributeLeft: return @"rcl_left";
+		case RCLAttributeTrailing: return @"rcl_trailing";
+		case RCLAttributeLeading: return @"rcl_leading";
+		case RCLAttributeBaseline: return @"rcl_baseline";
+		case RCLAttributeTolerance: return @"rcl_tolerance";
+	}
+}
+
+// The steps of a plan, in a form which can be captured by its operation.
+typedef struct {
+	// The attributes to apply, in order.
+	RCLAttribute attributes[RCL_ATTRIBUTE_COUNT];
+	NSUInteger count;
+
+	// Whether the plan starts from the intrinsic bounds, instead of from
+	// RCLAttributeRect.
+	BOOL usesIntrinsicBounds;
+
+	// Whether the first value passed to the operation is the leading edge for
+	// the current writing direction.
+	BOOL usesWritingDirection;
+} RCLLayoutPlanSteps;
+
+// Returns the edge which `attribute` aligns, given the leading edge for the
+// current writing direction.
+static RCLRectEdge edgeForAttribute(RCLAttribute attribute, RCLRectEdge leadingEdge) {
+	switch (attribute) {
+		case RCLAttributeLeft:
+			return RCLRectMinXEdge;
+
+		case RCLAttributeRight:
+			return RCLRectMaxXEdge;
+
+		#ifdef RCL_FOR_IPHONE
+		case RCLAttributeTop:
+			return RCLRectMinYEdge;
+
+		case RCLAttributeBottom:
+			return RCLRectMaxYEdge;
+		#else
+		case RCLAttributeTop:
+			return RCLRectMaxYEdge;
+
+		case RCLAttributeBottom:
+			return RCLRectMinYEdge;
+		#endif
+
+		case RCLAttributeLeading:
+			return leadingEdge;
+
+		case RCLAttributeTrailing:
+			return RCLTrailingEdge(leadingEdge == RCLRectMaxXEdge);
+
+		default:
+			NSCAssert(NO, @"RCLAttribute does not represent an edge: %li", (long)attribute);
+			return RCLRectMinXEdge;
+	}
+}
+
+// Applies every step of a plan to the latest values of its operands.
+static RCLGeometry evaluateSteps(const RCLLayoutPlanSteps *steps, const RCLGeometry *values) {
+	RCLRectEdge leadingEdge = RCLRectMinXEdge;
+	if (steps->usesWritingDirection) {
+		leadingEdge = (RCLRectEdge)values[0].number;
+		values++;
+	}
+
+	CGRect rect = CGRectZero;
+	if (steps->usesIntrinsicBounds) {
+		NSCAssert(values[0].type == RCLGeometryTypeRect, @"Intrinsic bounds are not a CGRect: %@", RCLGeometryBox(values[0]));
+
+		rect = values[0].rect;
+		values++;
+	}
+
+	for (NSUInteger i = 0; i < steps->count; i++) {
+		RCLAttribute attribute = steps->attributes[i];
+		RCLGeometry value = *values++;
+
+		switch (attribute) {
+			case RCLAttributeRect:
+				NSCAssert(value.type == RCLGeometryTypeRect, @"Value for rcl_rect is not a CGRect: %@", RCLGeometryBox(value));
+				rect = value.rect;
+				break;
+
+			case RCLAttributeSize:
+				NSCAssert(value.type == RCLGeometryTypeSize, @"Value for rcl_size is not a CGSize: %@", RCLGeometryBox(value));
+				rect.size = value.size;
+				break;
+
+			case RCLAttributeOrigin:
+				NSCAssert(value.type == RCLGeometryTypePoint, @"Value for rcl_origin is not a CGPoint: %@", RCLGeometryBox(value));
+				rect.origin = value.point;
+				break;
+
+			case RCLAttributeCenter:
+				NSCAssert(value.type == RCLGeometryTypePoint, @"Value for rcl_center is not a CGPoint: %@", RCLGeometryBox(value));
+				rect = CGRectMake(value.point.x - CGRectGetWidth(rect) / 2, value.point.y - CGRectGetHeight(rect) / 2, CGRectGetWidth(rect), CGRectGetHeight(rect));
+				break;
+
+			case RCLAttributeWidth:
+				NSCAssert(value.type == RCLGeometryTypeNumber, @"Value for rcl_width is not a number: %@", RCLGeometryBox(value));
+				rect.size.width = value.number;
+				rect = CGRectStandardize(rect);
+				break;
+
+			case RCLAttributeHeight:
+				NSCAssert(value.type == RCLGeometryTypeNumber, @"Value for rcl_height is not a number: %@", RCLGeometryBox(value));
+				rect.size.height = value.number;
+				rect = CGRectStandardize(rect);
+				break;
+
+			case RCLAttributeCenterX:
+				NSCAssert(value.type == RCLGeometryTypeNumber, @"Value for rcl_centerX is not a number: %@", RCLGeometryBox(value));
+				rect.origin.x = value.number - CGRectGetWidth(rect) / 2;
+				rect = CGRectStandardize(rect);
+				break;
+
+			case RCLAttributeCenterY:
+				NSCAssert(value.type == RCLGeometryTypeNumber, @"Value for rcl_centerY is not a number: %@", RCLGeometryBox(value));
+				rect.origin.y = value.number - CGRectGetHeight(rect) / 2;
+				rect = CGRectStandardize(rect);
+				break;
+
+			case RCLAttributeBottom:
+			case RCLAttributeRight:
+			case RCLAttributeTop:
+			case RCLAttributeLeft:
+			case RCLAttributeTrailing:
+			case RCLAttributeLeading:
+				NSCAssert(value.type == RCLGeometryTypeNumber, @"Value for %@ is not a number: %@", NSStringFromRCLAttribute(attribute), RCLGeometryBox(value));
+				rect = RCLRectAlignEdge(rect, edgeForAttribute(attribute, leadingEdge), value.number);
+				break;
+
+			case RCLAttributeBaseline: {
+				RCLGeometry referenceBaseline = *values++;
+				RCLGeometry referenceRect = *values++;
+
+				NSCAssert(value.type == RCLGeometryTypeNumber, @"Baseline is not a number: %@", RCLGeometryBox(value));
+				NSCAssert(referenceBaseline.type == RCLGeometryTypeNumber, @"Reference baseline is not a number: %@", RCLGeometryBox(referenceBaseline));
+				NSCAssert(referenceRect.type == RCLGeometryTypeRect, @"Reference rect is not a CGRect: %@", RCLGeometryBox(referenceRect));
+
+				#ifdef RCL_FOR_IPHONE
+					BOOL flipped = YES;
+				#else
+					BOOL flipped = NO;
+				#endif
+
+				rect = RCLRectAlignBaseline(rect, value.number, referenceRect.rect, referenceBaseline.number, flipped);
+				break;
+			}
+		}
+	}
+
+	return RCLGeometryMakeRect(rect);
+}
+
+@interface RCLLayoutPlan () {
+	RCLLayoutPlanSteps _steps;
+}
+
+// Evaluates the receiver's steps, given the latest values of the operands
+// passed to -rectSignalWithSignals:intrinsicBoundsSignal:baselineSignal:.
+//
+// This is shared by every signal created from the receiver.
+@property (nonatomic, copy, readonly) RCLGeometryOperation operation;
+
+@end
+
+@implementation RCLLayoutPlan
+
+#pragma mark Lifecycle
+
++ (instancetype)planForAttributes:(RCLAttributeMask)attributes {
+	NSParameterAssert(attributes != 0);
+	NSParameterAssert(attributes < (1 << RCL_ATTRIBUTE_COUNT));
+
+	static NSMutableDictionary *plansByAttributes = nil;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		plansByAttributes = [NSMutableDictionary dictionary];
+	});
+
+	@synchronized (plansByAttributes) {
+		RCLLayoutPlan *plan = plansByAttributes[@(attributes)];
+		if (plan == nil) {
+			plan = [[self alloc] initWithAttributes:attributes];
+			plansByAttributes[@(attributes)] = plan;
+		}
+
+		return plan;
+	}
+}
+
+- (id)initWithAttributes:(RCLAttributeMask)attributes {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_attributes = attributes;
+
+	// Bits are visited in ascending order, which is the order that attributes
+	// are applied in.
+	for (RCLAttribute attribute = RCLAttributeRect; attribute < RCL_ATTRIBUTE_COUNT; attribute++) {
+		if ((attributes & (1 << attribute)) == 0) continue;
+
+		_steps.attributes[_steps.count++] = attribute;
+
+		if (attribute == RCLAttributeLeading || attribute == RCLAttributeTrailing) {
+			_steps.usesWritingDirection = YES;
+		}
+	}
+
+	_steps.usesIntrinsicBounds = (attributes & (1 << RCLAttributeRect)) == 0;
+
+	RCLLayoutPlanSteps steps = _steps;
+	_operation = [^(const RCLGeometry *values) {
+		return evaluateSteps(&steps, values);
+	} copy];
+
+	return self;
+}
+
+#pragma mark Evaluation
+
+- (RACSignal *)rectSignalWithSignals:(NSDictionary *)signals intrinsicBoundsSignal:(RACSignal *)intrinsicBoundsSignal baselineSignal:(RACSignal *)baselineSignal {
+	NSParameterAssert(signals.count == _steps.count);
+	NSParameterAssert((intrinsicBoundsSignal != nil) == _steps.usesIntrinsicBounds);
+
+	NSMutableArray *operands = [NSMutableArray arrayWithCapacity:_steps.count + 3];
+	if (_steps.usesIntrinsicBounds) [operands addObject:intrinsicBoundsSignal];
+
+	for (NSUInteger i = 0; i < _steps.count; i++) {
+		RCLAttribute attribute = _steps.attributes[i];
+
+		RACSignal *signal = signals[@(attribute)];
+		NSAssert(signal != nil, @"No signal provided for attribute %li", (long)attribute);
+
+		if (attribute != RCLAttributeBaseline) {
+			[operands addObject:signal];
+			continue;
+		}
+
+		NSParameterAssert(baselineSignal != nil);
+
+		RACSignal *views = [signal replayLast];
+		RACSignal *referenceBaseline = [[views
+			map:^(id view) {
+				return [view rcl_baselineSignal];
+			}]
+			switchToLatest];
+
+		RACSignal *referenceRect = [[views
+			map:^(id view) {
+				return [view rcl_alignmentRectSignal];
+			}]
+			switchToLatest];
+
+		[operands addObjectsFromArray:@[ baselineSignal, referenceBaseline, referenceRect ]];
+	}
+
+	// The edge signal never completes, so don't wait for it.
+	NSArray *auxiliaryOperands = (_steps.usesWritingDirection ? @[ RACSignal.leadingEdgeSignal ] : @[]);
+
+	return [[RCLGeometrySignal signalWithOperands:operands auxiliaryOperands:auxiliaryOperands operation:self.operation]
+		rcl_setNameWithBlock:RCLName(@"%@ -rectSignalWithSignals: %@", self, signals)];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	NSMutableArray *names = [NSMutableArray arrayWithCapacity:_steps.count];
+	for (NSUInteger i = 0; i < _steps.count; i++) {
+		[names addObject:NSStringFromRCLAttribute(_steps.attributes[i])];
+	}
+
+	return [NSString stringWithFormat:@"<%@: %p>{ attributes = %@ }", self.class, self, [names componentsJoinedByString:@", "]];
+}
+
+@end
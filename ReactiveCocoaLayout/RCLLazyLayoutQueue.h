@@ -0,0 +1,67 @@
+//
+//  RCLLazyLayoutQueue.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <ReactiveCocoa/ReactiveCocoa.h>
+
+@class RCLGeometrySignal;
+
+// Tracks bindings whose inputs have changed, and only computes and assigns
+// their values when they might be seen.
+//
+// This is used by RCLRectAssignmentTrampoline when lazy layout is enabled.
+@interface RCLLazyLayoutQueue : NSObject
+
+// The scheduler upon which dirty bindings are laid out.
+@property (nonatomic, strong, readonly) RACScheduler *scheduler;
+
+// Initializes the receiver to lay out dirty bindings on the given scheduler.
+//
+// scheduler - The scheduler upon which to flush. This must not be nil.
+- (id)initWithScheduler:(RACScheduler *)scheduler;
+
+// Binds `keyPath` on `view` to the values of `signal`.
+//
+// Whenever the operands of `signal` change, the binding is marked dirty, and
+// a flush is scheduled if one isn't already pending. The value of the signal
+// is not computed until the binding is flushed, or until `view` becomes
+// visible by moving into a window or being unhidden.
+//
+// This method is thread-safe. It doesn't inspect `view`.
+//
+// signal  - The signal of rects to bind. This must not be `constant`.
+// keyPath - The key path to assign values to.
+// view    - The view to bind. This is not retained.
+//
+// Returns a disposable which will remove the binding.
+- (RACDisposable *)bindSignal:(RCLGeometrySignal *)signal toKeyPath:(NSString *)keyPath onView:(id)view;
+
+// Lays out every dirty binding whose view is in a window, and is not hidden
+// or inside a hidden view. Views outside of their window's bounds are still
+// laid out.
+//
+// Bindings of other views stay dirty until they're flushed with -flushView:,
+// or until their views become visible. While any are left, the main run loop
+// checks them, and their superviews, before it waits, and lays out those
+// which have become visible before they're drawn.
+//
+// If laying out one view dirties others, those will also be laid out before
+// this method returns.
+//
+// Views are only inspected on the main thread. If this is invoked on another
+// thread, the flush is performed asynchronously on the main thread.
+- (void)flush;
+
+// Lays out every dirty binding of `view` and its descendants, whether or not
+// they're visible.
+//
+// This must be invoked on the main thread.
+//
+// view - The root of the subtree to lay out. This must not be nil.
+- (void)flushView:(id)view;
+
+@end
@@ -0,0 +1,293 @@
+//
+//  RCLLazyLayoutQueue.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLLazyLayoutQueue.h"
+#import "RACSignal+RCLAnimationAdditions.h"
+#import "RACSignal+RCLGeometryAdditions.h"
+#import "RCLGeometrySignal.h"
+
+#ifdef RCL_FOR_IPHONE
+#import <UIKit/UIKit.h>
+#else
+#import <AppKit/AppKit.h>
+#endif
+
+// The order of the run loop observer which lays out views that have become
+// visible. Core Animation commits transactions at order 2000000, so this runs
+// just before anything is drawn.
+static const CFIndex RCLLazyLayoutObserverOrder = 1999000;
+
+// Determines whether `view` could currently be seen, because it's in a window
+// and neither it nor any of its ancestors is hidden.
+//
+// Views positioned outside of their window's bounds still count as visible,
+// since the pending rect may be what moves them back on screen.
+//
+// This must be invoked on the main thread.
+static BOOL RCLViewIsVisible(id view) {
+	NSCAssert(NSThread.isMainThread, @"Visibility of %@ must be checked on the main thread", view);
+
+	#ifdef RCL_FOR_IPHONE
+		if ([view window] == nil) return NO;
+
+		for (UIView *ancestor = view; ancestor != nil; ancestor = ancestor.superview) {
+			if (ancestor.hidden) return NO;
+		}
+
+		return YES;
+	#else
+		return [view window] != nil && ![view isHiddenOrHasHiddenAncestor];
+	#endif
+}
+
+// Determines whether `view` is `root`, or one of its descendants.
+//
+// This must be invoked on the main thread.
+static BOOL RCLViewIsInSubtree(id view, id root) {
+	#ifdef RCL_FOR_IPHONE
+		return [view isDescendantOfView:root];
+	#else
+		return [view isDescendantOf:root];
+	#endif
+}
+
+// A key path of a view, bound to a lazy geometry subscription.
+@interface RCLLazyLayoutBinding : NSObject
+
+// The view to assign values to.
+@property (nonatomic, weak) id view;
+
+// The key path to assign values to.
+@property (nonatomic, copy) NSString *keyPath;
+
+// The subscription supplying values.
+@property (nonatomic, strong) id<RCLLazyGeometrySubscription> subscription;
+
+// Computes the latest value of `subscription`, and assigns it to `view`, if
+// the subscription is dirty.
+- (void)apply;
+
+@end
+
+@interface RCLLazyLayoutQueue ()
+
+// The RCLLazyLayoutBindings which have become dirty, and have not been
+// applied yet.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMutableArray *dirtyBindings;
+
+// Whether a flush has been scheduled, but not yet started.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, assign) BOOL flushScheduled;
+
+// Lays out the dirty bindings of views which have become visible, before each
+// pass of the main run loop waits, or NULL if no binding was left dirty by the
+// last flush.
+//
+// This must only be accessed on the main thread.
+@property (nonatomic, assign) CFRunLoopObserverRef visibilityObserver;
+
+// Adds or removes `visibilityObserver`, depending on whether any bindings are
+// still dirty.
+//
+// This must be invoked on the main thread.
+- (void)updateVisibilityObserver;
+
+// Applies dirty bindings whose views pass the given test, until none remain.
+//
+// Bindings whose views have been deallocated are discarded.
+- (void)flushBindingsPassingTest:(BOOL (^)(id view))predicate;
+
+@end
+
+@implementation RCLLazyLayoutQueue
+
+#pragma mark Lifecycle
+
+- (id)initWithScheduler:(RACScheduler *)scheduler {
+	NSCParameterAssert(scheduler != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_scheduler = scheduler;
+	_dirtyBindings = [NSMutableArray array];
+
+	return self;
+}
+
+#pragma mark Binding
+
+- (RACDisposable *)bindSignal:(RCLGeometrySignal *)signal toKeyPath:(NSString *)keyPath onView:(id)view {
+	NSCParameterAssert(signal != nil);
+	NSCParameterAssert(keyPath != nil);
+	NSCParameterAssert(view != nil);
+
+	RCLLazyLayoutBinding *binding = [[RCLLazyLayoutBinding alloc] init];
+	binding.view = view;
+	binding.keyPath = keyPath;
+
+	// The subscription retains this block, so only capture the binding weakly.
+	__weak RCLLazyLayoutBinding *weakBinding = binding;
+
+	binding.subscription = [signal subscribeLazily:^{
+		RCLLazyLayoutBinding *binding = weakBinding;
+		if (binding == nil) return;
+
+		// Animated changes need to be applied right away, or they won't be
+		// part of the animation. Values received while subscribing are
+		// handled below, once the subscription is available.
+		if (RCLIsInAnimatedSignal() && binding.subscription != nil) {
+			[binding apply];
+			return;
+		}
+
+		BOOL needsFlush = NO;
+
+		@synchronized (self) {
+			[self.dirtyBindings addObject:binding];
+
+			if (!self.flushScheduled) {
+				self.flushScheduled = YES;
+				needsFlush = YES;
+			}
+		}
+
+		if (needsFlush) {
+			[self.scheduler schedule:^{
+				[self flush];
+			}];
+		}
+	} error:^(NSError *error) {
+		NSCAssert(NO, @"Received error from %@ in binding for key path \"%@\" on %@: %@", signal, keyPath, weakBinding.view, error);
+
+		// Log the error if we're running with assertions disabled.
+		NSLog(@"Received error from %@ in binding for key path \"%@\" on %@: %@", signal, keyPath, weakBinding.view, error);
+	}];
+
+	return [RACDisposable disposableWithBlock:^{
+		[binding.subscription dispose];
+
+		@synchronized (self) {
+			[self.dirtyBindings removeObjectIdenticalTo:binding];
+		}
+	}];
+}
+
+#pragma mark Flushing
+
+- (void)flush {
+	// Views may only be inspected and laid out on the main thread.
+	if (!NSThread.isMainThread) {
+		dispatch_async(dispatch_get_main_queue(), ^{
+			[self flush];
+		});
+
+		return;
+	}
+
+	@synchronized (self) {
+		self.flushScheduled = NO;
+	}
+
+	[self flushBindingsPassingTest:^(id view) {
+		return RCLViewIsVisible(view);
+	}];
+
+	[self updateVisibilityObserver];
+}
+
+- (void)flushView:(id)view {
+	NSCParameterAssert(view != nil);
+	NSCAssert(NSThread.isMainThread, @"%@ must be laid out on the main thread", view);
+
+	[self flushBindingsPassingTest:^(id candidate) {
+		return RCLViewIsInSubtree(candidate, view);
+	}];
+}
+
+- (void)flushBindingsPassingTest:(BOOL (^)(id view))predicate {
+	NSCParameterAssert(predicate != nil);
+
+	// Applying values may dirty more bindings, so keep going until everything
+	// has settled.
+	while (YES) {
+		NSArray *bindings = nil;
+
+		@synchronized (self) {
+			NSIndexSet *indexes = [self.dirtyBindings indexesOfObjectsPassingTest:^(RCLLazyLayoutBinding *binding, NSUInteger index, BOOL *stop) {
+				id view = binding.view;
+				return (BOOL)(view == nil || predicate(view));
+			}];
+
+			if (indexes.count == 0) return;
+
+			bindings = [self.dirtyBindings objectsAtIndexes:indexes];
+			[self.dirtyBindings removeObjectsAtIndexes:indexes];
+		}
+
+		RCLPerformLayoutTransaction(^{
+			for (RCLLazyLayoutBinding *binding in bindings) {
+				[binding apply];
+			}
+		});
+	}
+}
+
+#pragma mark Visibility
+
+- (void)updateVisibilityObserver {
+	NSCAssert(NSThread.isMainThread, @"%@ must observe visibility on the main thread", self);
+
+	BOOL hasDirtyBindings = NO;
+	@synchronized (self) {
+		hasDirtyBindings = (self.dirtyBindings.count > 0);
+	}
+
+	if (hasDirtyBindings == (self.visibilityObserver != NULL)) return;
+
+	if (!hasDirtyBindings) {
+		CFRunLoopObserverInvalidate(self.visibilityObserver);
+		CFRelease(self.visibilityObserver);
+		self.visibilityObserver = NULL;
+		return;
+	}
+
+	// Nothing tells a subview when it becomes visible because a superview
+	// was unhidden or moved into a window, so check the remaining views,
+	// and their superviews, whenever the run loop is about to wait. This
+	// only happens while some binding is waiting to become visible, and
+	// removes itself once none are.
+	self.visibilityObserver = CFRunLoopObserverCreateWithHandler(NULL, kCFRunLoopBeforeWaiting, true, RCLLazyLayoutObserverOrder, ^(CFRunLoopObserverRef observer, CFRunLoopActivity activity) {
+		[self flushBindingsPassingTest:^(id view) {
+			return RCLViewIsVisible(view);
+		}];
+
+		[self updateVisibilityObserver];
+	});
+
+	CFRunLoopAddObserver(CFRunLoopGetMain(), self.visibilityObserver, kCFRunLoopCommonModes);
+}
+
+@end
+
+@implementation RCLLazyLayoutBinding
+
+- (void)apply {
+	id view = self.view;
+	if (view == nil) return;
+
+	RCLGeometry value = [self.subscription takeDirtyValue];
+	if (value.type == RCLGeometryTypeNone) return;
+
+	[view setValue:RCLGeometryBox(value) forKeyPath:self.keyPath];
+}
+
+@end
@@ -8,6 +8,7 @@
 
 #import <Archimedes/Archimedes.h>
 #import <ReactiveCocoa/ReactiveCocoa.h>
+#import <ReactiveCocoaLayout/RACSignal+RCLGeometryAdditions.h>
 
 #ifdef RCL_FOR_IPHONE
 #import <UIKit/UIKit.h>
@@ -141,6 +142,15 @@
 // always relative to views' alignment rectangles.
 #define rcl_baseline @(RCLAttributeBaseline)
 
+// Corresponds to a constant CGFloat, which overrides the change tolerance of
+// the binding. This is not an attribute of the rectangle.
+//
+// The value must be a non-negative NSNumber. Any other value fails an
+// assertion, or is ignored if assertions are disabled.
+//
+// See +[RCLRectAssignmentTrampoline setChangeTolerance:].
+#define rcl_tolerance @(RCLAttributeTolerance)
+
 @interface RCLRectAssignmentTrampoline : NSObject
 
 #ifdef RCL_FOR_IPHONE
@@ -152,6 +162,129 @@
 - (RACSignal *)objectForKeyedSubscript:(NSString *)property;
 - (void)setObject:(NSDictionary *)attributes forKeyedSubscript:(NSString *)property;
 
+// Sets the scheduler used to coalesce the values assigned by bindings which
+// are created afterward with `RCLFrame` or `RCLAlignment`.
+//
+// By default, every rect sent by a binding is immediately assigned to the view.
+// When a coalescing scheduler is set, bindings instead stage the latest rect
+// for each view, and all staged rects are assigned together when the scheduler
+// next performs work. Any rects which were overwritten in the meantime are
+// never assigned.
+//
+// Rects sent from within -animate (or a variant thereof) are always assigned
+// immediately, so that they remain part of the animation.
+//
+// scheduler - The scheduler upon which to assign staged rects, or nil to
+//             disable coalescing for new bindings. To assign rects once per run
+//             loop iteration, use +[RACScheduler mainThreadScheduler].
++ (void)setCoalescingScheduler:(RACScheduler *)scheduler;
+
+// The scheduler set with +setCoalescingScheduler:, or nil if new bindings
+// assign values immediately.
++ (RACScheduler *)coalescingScheduler;
+
+// Sets the scheduler used to evaluate bindings which are created afterward with
+// `RCLFrame` or `RCLAlignment`.
+//
+// By default, a binding computes its rect on whichever thread its inputs
+// change, which is usually the main thread. When a background layout
+// scheduler is set, changes to a binding's inputs only mark it as needing
+// evaluation. All such bindings are then evaluated together upon the given
+// scheduler, and the resulting rects are assigned in one batch upon the
+// coalescing scheduler, or the main thread if there isn't one.
+//
+// The operators which a binding is built from move off the main thread along
+// with it, except for distinct ones, like -distinctGeometry. View signals used
+// as inputs, such as -rcl_frameSignal, are always read and observed where the
+// views change.
+//
+// Rects sent from within -animate (or a variant thereof) are always computed
+// and assigned immediately, so that they remain part of the animation.
+//
+// scheduler - The scheduler upon which to evaluate bindings, or nil to
+//             evaluate new bindings immediately. This should generally be a
+//             background scheduler, like one returned from
+//             +[RACScheduler scheduler].
++ (void)setBackgroundLayoutScheduler:(RACScheduler *)scheduler;
+
+// The scheduler set with +setBackgroundLayoutScheduler:, or nil if new
+// bindings are evaluated immediately.
++ (RACScheduler *)backgroundLayoutScheduler;
+
+// Sets the scheduler used to lay out bindings which are created afterward with
+// `RCLFrame` or `RCLAlignment`, and enables lazy layout for them.
+//
+// A lazy binding does not compute a rect when its inputs change. Instead, the
+// binding is marked dirty, and its rect is computed and assigned when the
+// scheduler next performs work -- but only if the view is in a window, and
+// neither it nor any of its superviews is hidden. Bindings of other views stay
+// dirty until their views become visible, by moving into a window or being
+// unhidden (directly or through a superview), at which point they're laid out
+// before being displayed. Subtrees which are hidden or outside of a window
+// therefore cost nothing to keep bound while their inputs change, except for
+// a check of their views before each pass of the main run loop waits.
+//
+// Views which are in a window, but positioned outside of its bounds, are laid
+// out like any other, since their new rects may bring them back on screen.
+//
+// Views are only inspected and laid out on the main thread, whichever
+// scheduler is given here.
+//
+// Lazy layout takes precedence over +setBackgroundLayoutScheduler: and
+// +setCoalescingScheduler:. Rects sent from within -animate (or a variant
+// thereof) are always assigned immediately.
+//
+// scheduler - The scheduler upon which to lay out dirty bindings, or nil to
+//             disable lazy layout for new bindings.
++ (void)setLazyLayoutScheduler:(RACScheduler *)scheduler;
+
+// The scheduler set with +setLazyLayoutScheduler:, or nil if new bindings
+// compute their rects eagerly.
++ (RACScheduler *)lazyLayoutScheduler;
+
+// Immediately lays out every dirty lazy binding of `view` and its subviews,
+// whether or not they're visible.
+//
+// Views are laid out automatically when they become visible, so this is only
+// needed to read the frame of a view that isn't visible yet.
+//
+// This must be invoked on the main thread.
+//
+// view - The root of the subtree to lay out. If nil, nothing happens.
+#ifdef RCL_FOR_IPHONE
++ (void)layoutViewIfNeeded:(UIView *)view;
+#else
++ (void)layoutViewIfNeeded:(NSView *)view;
+#endif
+
+// Sets the tolerance used by bindings which are created afterward with
+// `RCLFrame` or `RCLAlignment`.
+//
+// Arithmetic like -multipliedBy:, -dividedBy:, and centering can produce rects
+// which differ from the previous one only by rounding error. A binding with
+// a tolerance compares each new rect against the last one that it sent, and
+// skips it if no component differs by more than the tolerance. The comparison
+// happens before the rect is boxed, coalesced, or assigned.
+//
+// Because each rect is compared against the last one sent, rather than the
+// last one computed, a binding can settle up to `tolerance` away from its true
+// final value. For example, with a tolerance of 1, a rect which moves by half
+// a point twice is never assigned, and is left a whole point short.
+//
+// Independently of any tolerance, views do not assign a rect which aligns to
+// the same device pixels as their current frame or bounds, so changes smaller
+// than a pixel never cause a redisplay.
+//
+// An individual binding can override this with the `rcl_tolerance` key.
+//
+// tolerance - The largest difference in any component of a rect which should
+//             be ignored, in points. This must not be negative. The default
+//             is 0, which sends every rect.
++ (void)setChangeTolerance:(CGFloat)tolerance;
+
+// The tolerance set with +setChangeTolerance:.
++ (CGFloat)changeTolerance;
+
 @end
 
 // Do not use this directly. Use the `rcl_` keys above.
@@ -172,17 +305,20 @@ typedef enum : NSInteger {
 	RCLAttributeLeft,
 	RCLAttributeTrailing,
 	RCLAttributeLeading,
-	RCLAttributeBaseline
+	RCLAttributeBaseline,
+
+	// Not an attribute of the rectangle, and never part of a layout plan.
+	RCLAttributeTolerance
 } RCLAttribute;
 
 #define RCLBox_struct_(TYPE) \
     __attribute__((overloadable)) static inline RACSignal *RCLBox(TYPE value) { \
-        return [RACSignal return:MEDBox(value)]; \
+        return [RACSignal constant:MEDBox(value)]; \
     }
 
 #define RCLBox_number_(TYPE) \
     __attribute__((overloadable)) static inline RACSignal *RCLBox(TYPE value) { \
-        return [RACSignal return:@(value)]; \
+        return [RACSignal constant:@(value)]; \
     }
 
 RCLBox_struct_(CGRect);
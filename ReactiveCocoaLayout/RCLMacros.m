@@ -7,7 +7,13 @@
 //
 
 #import "RCLMacros.h"
+#import "RACSignal+RCLAnimationAdditions.h"
 #import "RACSignal+RCLGeometryAdditions.h"
+#import "RCLAssignmentCoalescer.h"
+#import "RCLBackgroundLayoutQueue.h"
+#import "RCLGeometrySignal.h"
+#import "RCLLayoutPlan.h"
+#import "RCLLazyLayoutQueue.h"
 #import <ReactiveCocoa/EXTScope.h>
 
 #ifdef RCL_FOR_IPHONE
@@ -16,25 +22,33 @@
 #import "NSView+RCLGeometryAdditions.h"
 #endif
 
-static NSString *NSStringFromRCLAttribute(RCLAttribute attribute) __attribute__((unused)) {
-	switch (attribute) {
-		case RCLAttributeRect: return @"rcl_rect";
-		case RCLAttributeSize: return @"rcl_size";
-		case RCLAttributeOrigin: return @"rcl_origin";
-		case RCLAttributeHeight: return @"rcl_height";
-		case RCLAttributeWidth: return @"rcl_width";
-		case RCLAttributeCenter: return @"rcl_center";
-		case RCLAttributeCenterX: return @"rcl_centerX";
-		case RCLAttributeCenterY: return @"rcl_centerY";
-		case RCLAttributeBottom: return @"rcl_bottom";
-		case RCLAttributeRight: return @"rcl_right";
-		case RCLAttributeTop: return @"rcl_top";
-		case RCLAttributeLeft: return @"rcl_left";
-		case RCLAttributeTrailing: return @"rcl_trailing";
-		case RCLAttributeLeading: return @"rcl_leading";
-		case RCLAttributeBaseline: return @"rcl_baseline";
-	}
-}
+// Stages the values of new bindings, or nil if they should be assigned
+// immediately.
+//
+// This must only be accessed while synchronized on RCLRectAssignmentTrampoline.
+static RCLAssignmentCoalescer *RCLCurrentAssignmentCoalescer = nil;
+
+// Lays out new bindings lazily, or nil if they should be evaluated eagerly.
+//
+// This must only be accessed while synchronized on RCLRectAssignmentTrampoline.
+static RCLLazyLayoutQueue *RCLCurrentLazyLayoutQueue = nil;
+
+// Evaluates new bindings in the background, or nil if they should be evaluated
+// on the thread where their inputs change.
+//
+// This must only be accessed while synchronized on RCLRectAssignmentTrampoline.
+static RCLBackgroundLayoutQueue *RCLCurrentBackgroundLayoutQueue = nil;
+
+// Every RCLLazyLayoutQueue which still has bindings, including ones created
+// for previous schedulers. The queues are not retained.
+//
+// This must only be accessed while synchronized on RCLRectAssignmentTrampoline.
+static NSHashTable *RCLLazyLayoutQueues = nil;
+
+// The tolerance of new bindings which don't specify `rcl_tolerance`.
+//
+// This must only be accessed while synchronized on RCLRectAssignmentTrampoline.
+static CGFloat RCLCurrentChangeTolerance = 0;
 
 @interface RCLRectAssignmentTrampoline ()
 
@@ -67,7 +81,165 @@ static NSString *NSStringFromRCLAttribute(RCLAttribute attribute) __attribute__(
 	NSParameterAssert(property != nil);
 	NSParameterAssert([bindings isKindOfClass:NSDictionary.class]);
 
-	[[self rectSignalFromBindings:bindings] setKeyPath:property onObject:self.view];
+	NSNumber *tolerance = nil;
+	id toleranceValue = bindings[rcl_tolerance];
+	if (toleranceValue != nil) {
+		tolerance = [self changeToleranceWithValue:toleranceValue];
+
+		NSMutableDictionary *attributeBindings = [bindings mutableCopy];
+		[attributeBindings removeObjectForKey:rcl_tolerance];
+		bindings = attributeBindings;
+	}
+
+	RACSignal *signal = [self rectSignalFromBindings:bindings];
+
+	RCLAssignmentCoalescer *coalescer = nil;
+	RCLLazyLayoutQueue *lazyLayoutQueue = nil;
+	RCLBackgroundLayoutQueue *backgroundLayoutQueue = nil;
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		coalescer = RCLCurrentAssignmentCoalescer;
+		lazyLayoutQueue = RCLCurrentLazyLayoutQueue;
+		backgroundLayoutQueue = RCLCurrentBackgroundLayoutQueue;
+		if (tolerance == nil) tolerance = @(RCLCurrentChangeTolerance);
+	}
+
+	// Skip rects which differ from the last one only by rounding error, before
+	// they're boxed or handed to any queue.
+	CGFloat changeTolerance = tolerance.doubleValue;
+	if (changeTolerance > 0) signal = [signal distinctGeometryWithTolerance:changeTolerance];
+
+	// Constant rects are only ever assigned once, so there's nothing to defer.
+	if ([signal isKindOfClass:RCLGeometrySignal.class] && ![(RCLGeometrySignal *)signal isConstant]) {
+		NSObject *view = self.view;
+
+		if (lazyLayoutQueue != nil) {
+			[view.rac_deallocDisposable addDisposable:[lazyLayoutQueue bindSignal:(RCLGeometrySignal *)signal toKeyPath:property onView:view]];
+			return;
+		}
+
+		if (backgroundLayoutQueue != nil) {
+			[view.rac_deallocDisposable addDisposable:[backgroundLayoutQueue bindSignal:(RCLGeometrySignal *)signal toKeyPath:property onView:view]];
+			return;
+		}
+	}
+
+	if (coalescer == nil) {
+		[signal setKeyPath:property onObject:self.view];
+		return;
+	}
+
+	NSObject *view = self.view;
+	@weakify(view);
+
+	RACDisposable *disposable = [signal subscribeNext:^(NSValue *rect) {
+		@strongify(view);
+		if (view == nil) return;
+
+		// Animated changes need to be applied right away, or they won't be
+		// part of the animation.
+		if (RCLIsInAnimatedSignal()) {
+			[coalescer applyValue:rect forKeyPath:property onObject:view];
+		} else {
+			[coalescer stageValue:rect forKeyPath:property onObject:view];
+		}
+	} error:^(NSError *error) {
+		@strongify(view);
+		NSCAssert(NO, @"Received error from %@ in binding for key path \"%@\" on %@: %@", signal, property, view, error);
+
+		// Log the error if we're running with assertions disabled.
+		NSLog(@"Received error from %@ in binding for key path \"%@\" on %@: %@", signal, property, view, error);
+	}];
+
+	[view.rac_deallocDisposable addDisposable:disposable];
+}
+
+#pragma mark Coalescing
+
++ (void)setCoalescingScheduler:(RACScheduler *)scheduler {
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		if (scheduler == RCLCurrentAssignmentCoalescer.scheduler) return;
+
+		RCLCurrentAssignmentCoalescer = (scheduler == nil ? nil : [[RCLAssignmentCoalescer alloc] initWithScheduler:scheduler]);
+
+		// Background layout commits upon the coalescing scheduler, if there
+		// is one.
+		RACScheduler *evaluationScheduler = RCLCurrentBackgroundLayoutQueue.evaluationScheduler;
+		if (evaluationScheduler != nil) {
+			RCLCurrentBackgroundLayoutQueue = [[RCLBackgroundLayoutQueue alloc] initWithEvaluationScheduler:evaluationScheduler commitScheduler:scheduler ?: RACScheduler.mainThreadScheduler];
+		}
+	}
+}
+
++ (RACScheduler *)coalescingScheduler {
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		return RCLCurrentAssignmentCoalescer.scheduler;
+	}
+}
+
+#pragma mark Background Layout
+
++ (void)setBackgroundLayoutScheduler:(RACScheduler *)scheduler {
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		if (scheduler == RCLCurrentBackgroundLayoutQueue.evaluationScheduler) return;
+
+		RACScheduler *commitScheduler = RCLCurrentAssignmentCoalescer.scheduler ?: RACScheduler.mainThreadScheduler;
+		RCLCurrentBackgroundLayoutQueue = (scheduler == nil ? nil : [[RCLBackgroundLayoutQueue alloc] initWithEvaluationScheduler:scheduler commitScheduler:commitScheduler]);
+	}
+}
+
++ (RACScheduler *)backgroundLayoutScheduler {
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		return RCLCurrentBackgroundLayoutQueue.evaluationScheduler;
+	}
+}
+
+#pragma mark Lazy Layout
+
++ (void)setLazyLayoutScheduler:(RACScheduler *)scheduler {
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		if (scheduler == RCLCurrentLazyLayoutQueue.scheduler) return;
+
+		RCLCurrentLazyLayoutQueue = (scheduler == nil ? nil : [[RCLLazyLayoutQueue alloc] initWithScheduler:scheduler]);
+		if (RCLCurrentLazyLayoutQueue == nil) return;
+
+		if (RCLLazyLayoutQueues == nil) RCLLazyLayoutQueues = [NSHashTable weakObjectsHashTable];
+		[RCLLazyLayoutQueues addObject:RCLCurrentLazyLayoutQueue];
+	}
+}
+
++ (RACScheduler *)lazyLayoutScheduler {
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		return RCLCurrentLazyLayoutQueue.scheduler;
+	}
+}
+
++ (void)layoutViewIfNeeded:(id)view {
+	if (view == nil) return;
+
+	NSArray *queues = nil;
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		queues = RCLLazyLayoutQueues.allObjects;
+	}
+
+	for (RCLLazyLayoutQueue *queue in queues) {
+		[queue flushView:view];
+	}
+}
+
+#pragma mark Change Tolerance
+
++ (void)setChangeTolerance:(CGFloat)tolerance {
+	NSParameterAssert(tolerance >= 0);
+
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		RCLCurrentChangeTolerance = tolerance;
+	}
+}
+
++ (CGFloat)changeTolerance {
+	@synchronized (RCLRectAssignmentTrampoline.class) {
+		return RCLCurrentChangeTolerance;
+	}
 }
 
 #pragma mark Attribute Parsing
@@ -75,96 +247,28 @@ static NSString *NSStringFromRCLAttribute(RCLAttribute attribute) __attribute__(
 - (RACSignal *)rectSignalFromBindings:(NSDictionary *)bindings {
 	NSParameterAssert(bindings != nil);
 
-	NSArray *sortedAttributes = [bindings.allKeys sortedArrayUsingSelector:@selector(compare:)];
+	RCLAttributeMask attributes = 0;
+	NSMutableDictionary *signals = [NSMutableDictionary dictionaryWithCapacity:bindings.count];
 
-	RACSignal *signal = [self.view rcl_intrinsicBoundsSignal];
-	for (NSNumber *attribute in sortedAttributes) {
+	for (NSNumber *attribute in bindings) {
 		NSAssert([attribute isKindOfClass:NSNumber.class], @"Layout binding key is not a RCLAttribute: %@", attribute);
+		NSAssert(attribute.integerValue >= 0 && attribute.integerValue <= RCLAttributeBaseline, @"Layout binding key is not a valid RCLAttribute: %@", attribute);
 
 		RACSignal *value = bindings[attribute];
 		if (![value isKindOfClass:RACSignal.class]) {
 			value = [self signalWithConstantValue:value forAttribute:attribute.integerValue];
 		}
 
-		switch (attribute.integerValue) {
-			case RCLAttributeRect:
-				signal = value;
-				break;
-
-			case RCLAttributeSize:
-				signal = [signal replaceSize:value];
-				break;
-
-			case RCLAttributeOrigin:
-				signal = [signal replaceOrigin:value];
-				break;
-
-			case RCLAttributeCenter:
-				signal = [signal alignCenter:value];
-				break;
-
-			case RCLAttributeWidth:
-				signal = [signal alignAttribute:NSLayoutAttributeWidth to:value];
-				break;
-
-			case RCLAttributeHeight:
-				signal = [signal alignAttribute:NSLayoutAttributeHeight to:value];
-				break;
-
-			case RCLAttributeCenterX:
-				signal = [signal alignAttribute:NSLayoutAttributeCenterX to:value];
-				break;
-
-			case RCLAttributeCenterY:
-				signal = [signal alignAttribute:NSLayoutAttributeCenterY to:value];
-				break;
-
-			case RCLAttributeBottom:
-				signal = [signal alignAttribute:NSLayoutAttributeBottom to:value];
-				break;
-
-			case RCLAttributeRight:
-				signal = [signal alignAttribute:NSLayoutAttributeRight to:value];
-				break;
-
-			case RCLAttributeTop:
-				signal = [signal alignAttribute:NSLayoutAttributeTop to:value];
-				break;
-
-			case RCLAttributeLeft:
-				signal = [signal alignAttribute:NSLayoutAttributeLeft to:value];
-				break;
-
-			case RCLAttributeTrailing:
-				signal = [signal alignAttribute:NSLayoutAttributeTrailing to:value];
-				break;
-
-			case RCLAttributeLeading:
-				signal = [signal alignAttribute:NSLayoutAttributeLeading to:value];
-				break;
-
-			case RCLAttributeBaseline: {
-				value = [value replayLast];
-
-				RACSignal *referenceRect = [[value
-					map:^(id view) {
-						return [view rcl_alignmentRectSignal];
-					}]
-					switchToLatest];
-
-				RACSignal *referenceBaseline = [[value
-					map:^(id view) {
-						return [view rcl_baselineSignal];
-					}]
-					switchToLatest];
-
-				signal = [signal alignBaseline:[self.view rcl_baselineSignal] toBaseline:referenceBaseline ofRect:referenceRect];
-				break;
-			}
-		}
+		attributes |= (RCLAttributeMask)1 << attribute.integerValue;
+		signals[attribute] = value;
 	}
 
-	return signal;
+	if (attributes == 0) return [self.view rcl_intrinsicBoundsSignal];
+
+	RACSignal *intrinsicBoundsSignal = ((attributes & ((RCLAttributeMask)1 << RCLAttributeRect)) == 0 ? [self.view rcl_intrinsicBoundsSignal] : nil);
+	RACSignal *baselineSignal = ((attributes & ((RCLAttributeMask)1 << RCLAttributeBaseline)) != 0 ? [self.view rcl_baselineSignal] : nil);
+
+	return [[RCLLayoutPlan planForAttributes:attributes] rectSignalWithSignals:signals intrinsicBoundsSignal:intrinsicBoundsSignal baselineSignal:baselineSignal];
 }
 
 - (RACSignal *)signalWithConstantValue:(id)value forAttribute:(RCLAttribute)attribute {
@@ -199,7 +303,18 @@ static NSString *NSStringFromRCLAttribute(RCLAttribute attribute) __attribute__(
 			NSAssert([value isKindOfClass:NSNumber.class], @"Expected a CGFloat for attribute %@, got %@", NSStringFromRCLAttribute(attribute), value);
 	}
 
-	return [RACSignal return:value];
+	return [RACSignal constant:value];
+}
+
+- (NSNumber *)changeToleranceWithValue:(id)value {
+	NSParameterAssert(value != nil);
+
+	BOOL valid = [value isKindOfClass:NSNumber.class] && [value doubleValue] >= 0;
+	NSAssert(valid, @"Expected a non-negative CGFloat for attribute %@, got %@", NSStringFromRCLAttribute(RCLAttributeTolerance), value);
+
+	// Assertions may be compiled out, so fall back to the default tolerance
+	// instead of crashing, or skipping rects against a negative tolerance.
+	return (valid ? value : nil);
 }
 
 @end
@@ -0,0 +1,50 @@
+//
+//  RCLProfiler+Private.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLProfiler.h"
+
+@class RCLGeometrySignal;
+
+// Whether the shared profiler is enabled.
+//
+// This is checked upon every evaluation of a geometry signal, so it's exposed
+// directly instead of requiring a message send.
+extern volatile BOOL RCLProfilerEnabled;
+
+// The number of values boxed by RCLGeometryBox() while the shared profiler was
+// enabled, since it was last reset.
+//
+// This must only be modified atomically.
+extern volatile int64_t RCLProfilerBoxedValueCount;
+
+// The outcome of one evaluation of a geometry signal.
+//
+// RCLProfilerOutcomeSent       - The evaluation sent a value.
+// RCLProfilerOutcomeSuppressed - The signal is distinct, and the result was
+//                                equal to the last value sent.
+// RCLProfilerOutcomeEmpty      - The operators did not produce a value, such
+//                                as when none of the signals given to +max:
+//                                have sent a number.
+typedef enum : NSUInteger {
+	RCLProfilerOutcomeSent,
+	RCLProfilerOutcomeSuppressed,
+	RCLProfilerOutcomeEmpty
+} RCLProfilerOutcome;
+
+@interface RCLProfiler (Private)
+
+// Records one evaluation of `signal`.
+//
+// signal   - The signal which was evaluated. This must not be nil.
+// duration - The time taken by the evaluation, in mach_absolute_time() units.
+// outcome  - Whether the evaluation sent a value, and why not if it didn't.
+//
+// This method is thread-safe.
+- (void)recordEvaluationOfSignal:(RCLGeometrySignal *)signal duration:(uint64_t)duration outcome:(RCLProfilerOutcome)outcome;
+
+@end
@@ -0,0 +1,90 @@
+//
+//  RCLProfiler.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Records how often geometry operators are evaluated and how long they take,
+// along with the graph of signals that they combine.
+//
+// Each node in the graph corresponds to one stage of geometry operators (see
+// -[RACSignal rcl_stageCount]), or to a signal which was combined by one.
+@interface RCLProfiler : NSObject
+
+// Returns the profiler which records all evaluations.
++ (instancetype)sharedProfiler;
+
+// Whether evaluations are currently being recorded. Defaults to NO.
+//
+// While disabled, the profiler adds only a single check to each evaluation.
+@property (atomic, assign, getter = isEnabled) BOOL enabled;
+
+// Snapshots of every node recorded so far, as RCLProfilerNodes, sorted by
+// descending total evaluation time.
+@property (atomic, copy, readonly) NSArray *nodes;
+
+// The number of values which geometry operators have boxed into NSNumbers or
+// NSValues while the receiver was enabled.
+//
+// Chains of geometry operators pass values between each other without boxing,
+// so a value is only boxed when it leaves the chain (e.g., to be sent to
+// a -subscribeNext: block, or bound to a property). This can be used to measure
+// the allocations caused by an update.
+@property (atomic, assign, readonly) uint64_t boxedValueCount;
+
+// Discards everything recorded so far, including `boxedValueCount`.
+- (void)reset;
+
+// Returns a Graphviz DOT description of the recorded nodes and their counters,
+// with edges pointing from each signal to the operators which combine it.
+- (NSString *)DOTRepresentation;
+
+// Returns a JSON object containing a `nodes` array, where each element
+// describes one RCLProfilerNode. Times are given in seconds.
+- (NSData *)JSONRepresentation;
+
+@end
+
+// A snapshot of the counters for one node recorded by an RCLProfiler.
+@interface RCLProfilerNode : NSObject
+
+// Uniquely identifies the receiver among the nodes of its profiler.
+@property (nonatomic, copy, readonly) NSString *identifier;
+
+// The name of the signal which the receiver represents.
+@property (nonatomic, copy, readonly) NSString *name;
+
+// Whether the receiver represents a stage of geometry operators.
+//
+// If NO, the receiver represents a signal that was combined by an operator,
+// and will not have any evaluations.
+@property (nonatomic, assign, readonly, getter = isGeometryOperator) BOOL geometryOperator;
+
+// The identifiers of the nodes which the receiver combines.
+@property (nonatomic, copy, readonly) NSArray *operandIdentifiers;
+
+// The number of times that the operators have been evaluated.
+@property (nonatomic, assign, readonly) NSUInteger evaluationCount;
+
+// The total and longest time spent in a single evaluation of the operators.
+//
+// This does not include the time taken by subscribers of the signal.
+@property (nonatomic, assign, readonly) NSTimeInterval totalTime;
+@property (nonatomic, assign, readonly) NSTimeInterval peakTime;
+
+// The number of evaluations which sent a value.
+@property (nonatomic, assign, readonly) NSUInteger sentCount;
+
+// The number of evaluations of a distinct signal which were suppressed,
+// because the result was equal to the last value sent.
+@property (nonatomic, assign, readonly) NSUInteger suppressedCount;
+
+// The number of evaluations which did not produce a value at all, such as
+// those of +max: before any of its signals have sent a number.
+@property (nonatomic, assign, readonly) NSUInteger emptyCount;
+
+@end
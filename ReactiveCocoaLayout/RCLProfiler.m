@@ -0,0 +1,354 @@
+//
+//  RCLProfiler.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLProfiler+Private.h"
+#import "RCLGeometrySignal.h"
+#import <libkern/OSAtomic.h>
+#import <mach/mach_time.h>
+
+volatile BOOL RCLProfilerEnabled = NO;
+volatile int64_t RCLProfilerBoxedValueCount = 0;
+
+// Converts a duration in mach_absolute_time() units into seconds.
+static NSTimeInterval RCLTimeIntervalFromMachDuration(uint64_t duration) {
+	static mach_timebase_info_data_t timebase;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		mach_timebase_info(&timebase);
+	});
+
+	return (NSTimeInterval)duration * timebase.numer / timebase.denom / NSEC_PER_SEC;
+}
+
+// Escapes a string for use within a quoted DOT identifier.
+static NSString *RCLEscapedDOTString(NSString *string) {
+	string = [string stringByReplacingOccurrencesOfString:@"\\" withString:@"\\\\"];
+	string = [string stringByReplacingOccurrencesOfString:@"\"" withString:@"\\\""];
+	return [string stringByReplacingOccurrencesOfString:@"\n" withString:@"\\n"];
+}
+
+// The counters for one node, as updated by an RCLProfiler.
+//
+// All access must be synchronized on the profiler.
+@interface RCLProfilerRecord : NSObject
+
+@property (nonatomic, copy, readonly) NSString *identifier;
+@property (nonatomic, copy, readonly) NSString *name;
+@property (nonatomic, assign, readonly, getter = isGeometryOperator) BOOL geometryOperator;
+
+// The records for the operands of the node.
+@property (nonatomic, copy) NSArray *operandRecords;
+
+@property (nonatomic, assign) NSUInteger evaluationCount;
+@property (nonatomic, assign) NSUInteger sentCount;
+@property (nonatomic, assign) NSUInteger suppressedCount;
+@property (nonatomic, assign) NSUInteger emptyCount;
+
+// Times, in mach_absolute_time() units.
+@property (nonatomic, assign) uint64_t totalDuration;
+@property (nonatomic, assign) uint64_t peakDuration;
+
+- (id)initWithIdentifier:(NSString *)identifier name:(NSString *)name geometryOperator:(BOOL)geometryOperator;
+
+@end
+
+@interface RCLProfilerNode ()
+
+// Initializes the receiver with the current counters of `record`.
+//
+// This must be invoked while synchronized on the profiler.
+- (id)initWithRecord:(RCLProfilerRecord *)record;
+
+@end
+
+@interface RCLProfiler ()
+
+// Maps signals to their RCLProfilerRecords, without retaining the signals.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMapTable *recordsBySignal;
+
+// Every RCLProfilerRecord, in the order they were created.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMutableArray *records;
+
+@end
+
+@implementation RCLProfiler
+
+#pragma mark Lifecycle
+
++ (instancetype)sharedProfiler {
+	static id singleton;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		singleton = [[self alloc] init];
+	});
+
+	return singleton;
+}
+
+- (id)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_recordsBySignal = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+	_records = [[NSMutableArray alloc] init];
+
+	return self;
+}
+
+#pragma mark Properties
+
+- (BOOL)isEnabled {
+	return RCLProfilerEnabled;
+}
+
+- (void)setEnabled:(BOOL)enabled {
+	RCLProfilerEnabled = enabled;
+}
+
+- (uint64_t)boxedValueCount {
+	return (uint64_t)OSAtomicAdd64(0, &RCLProfilerBoxedValueCount);
+}
+
+- (NSArray *)nodes {
+	NSMutableArray *nodes = [NSMutableArray array];
+
+	@synchronized (self) {
+		for (RCLProfilerRecord *record in self.records) {
+			[nodes addObject:[[RCLProfilerNode alloc] initWithRecord:record]];
+		}
+	}
+
+	[nodes sortWithOptions:NSSortStable usingComparator:^(RCLProfilerNode *a, RCLProfilerNode *b) {
+		if (a.totalTime > b.totalTime) return NSOrderedAscending;
+		if (a.totalTime < b.totalTime) return NSOrderedDescending;
+		return NSOrderedSame;
+	}];
+
+	return nodes;
+}
+
+#pragma mark Recording
+
+- (void)reset {
+	@synchronized (self) {
+		[self.recordsBySignal removeAllObjects];
+		[self.records removeAllObjects];
+	}
+
+	int64_t boxedValueCount;
+	do {
+		boxedValueCount = RCLProfilerBoxedValueCount;
+	} while (!OSAtomicCompareAndSwap64(boxedValueCount, 0, &RCLProfilerBoxedValueCount));
+}
+
+// Finds the names of `signal` and of the signals it combines, stopping at those
+// which already have records.
+//
+// Names are built lazily, and building one may take a while (or even lock
+// other signals), so this must not be invoked while synchronized on the
+// receiver.
+//
+// Returns a map table from signals to their names.
+- (NSMapTable *)namesOfUnrecordedSignalsFromSignal:(RACSignal *)signal {
+	NSMapTable *names = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+	NSMutableArray *pendingSignals = [NSMutableArray arrayWithObject:signal];
+
+	while (pendingSignals.count > 0) {
+		RACSignal *pendingSignal = pendingSignals.lastObject;
+		[pendingSignals removeLastObject];
+
+		if ([names objectForKey:pendingSignal] != nil) continue;
+
+		BOOL recorded;
+		@synchronized (self) {
+			recorded = ([self.recordsBySignal objectForKey:pendingSignal] != nil);
+		}
+
+		if (recorded) continue;
+
+		NSString *name = pendingSignal.name;
+		[names setObject:(name.length > 0 ? name : pendingSignal.description) forKey:pendingSignal];
+
+		if ([pendingSignal isKindOfClass:RCLGeometrySignal.class]) {
+			[pendingSignals addObjectsFromArray:[(RCLGeometrySignal *)pendingSignal operands]];
+		}
+	}
+
+	return names;
+}
+
+// Returns the record for `signal`, creating it (and records for its operands)
+// if necessary.
+//
+// names - The names of signals which may need new records, as returned by
+//         -namesOfUnrecordedSignalsFromSignal:.
+//
+// This must be invoked while synchronized on the receiver.
+- (RCLProfilerRecord *)recordForSignal:(RACSignal *)signal names:(NSMapTable *)names {
+	RCLProfilerRecord *record = [self.recordsBySignal objectForKey:signal];
+	if (record != nil) return record;
+
+	BOOL geometryOperator = [signal isKindOfClass:RCLGeometrySignal.class];
+	NSString *identifier = [NSString stringWithFormat:@"n%lu", (unsigned long)self.records.count];
+
+	// Another thread may have reset the profiler after the names were found,
+	// in which case the class is the best name available without building one.
+	NSString *name = [names objectForKey:signal] ?: NSStringFromClass(signal.class);
+
+	record = [[RCLProfilerRecord alloc] initWithIdentifier:identifier name:name geometryOperator:geometryOperator];
+	[self.recordsBySignal setObject:record forKey:signal];
+	[self.records addObject:record];
+
+	if (geometryOperator) {
+		NSMutableArray *operandRecords = [NSMutableArray array];
+		for (RACSignal *operand in [(RCLGeometrySignal *)signal operands]) {
+			[operandRecords addObject:[self recordForSignal:operand names:names]];
+		}
+
+		record.operandRecords = operandRecords;
+	}
+
+	return record;
+}
+
+- (void)recordEvaluationOfSignal:(RCLGeometrySignal *)signal duration:(uint64_t)duration outcome:(RCLProfilerOutcome)outcome {
+	NSCParameterAssert(signal != nil);
+
+	RCLProfilerRecord *record;
+	@synchronized (self) {
+		record = [self.recordsBySignal objectForKey:signal];
+	}
+
+	// Only the first evaluation of each signal has to find names.
+	NSMapTable *names = (record == nil ? [self namesOfUnrecordedSignalsFromSignal:signal] : nil);
+
+	@synchronized (self) {
+		record = [self recordForSignal:signal names:names];
+
+		record.evaluationCount++;
+		record.totalDuration += duration;
+		record.peakDuration = MAX(record.peakDuration, duration);
+
+		switch (outcome) {
+			case RCLProfilerOutcomeSent:
+				record.sentCount++;
+				break;
+
+			case RCLProfilerOutcomeSuppressed:
+				record.suppressedCount++;
+				break;
+
+			case RCLProfilerOutcomeEmpty:
+				record.emptyCount++;
+				break;
+		}
+	}
+}
+
+#pragma mark Exporting
+
+- (NSString *)DOTRepresentation {
+	NSArray *nodes = self.nodes;
+	NSMutableString *string = [NSMutableString stringWithString:@"digraph RCL {\n"];
+
+	for (RCLProfilerNode *node in nodes) {
+		if (node.geometryOperator) {
+			NSString *label = [NSString stringWithFormat:@"%@\nevaluations: %lu, sent: %lu, suppressed: %lu, empty: %lu\ntotal: %.3f ms, peak: %.3f ms", node.name, (unsigned long)node.evaluationCount, (unsigned long)node.sentCount, (unsigned long)node.suppressedCount, (unsigned long)node.emptyCount, node.totalTime * 1000, node.peakTime * 1000];
+			[string appendFormat:@"\t%@ [shape=box, label=\"%@\"];\n", node.identifier, RCLEscapedDOTString(label)];
+		} else {
+			[string appendFormat:@"\t%@ [shape=ellipse, label=\"%@\"];\n", node.identifier, RCLEscapedDOTString(node.name)];
+		}
+	}
+
+	for (RCLProfilerNode *node in nodes) {
+		for (NSString *operandIdentifier in node.operandIdentifiers) {
+			[string appendFormat:@"\t%@ -> %@;\n", operandIdentifier, node.identifier];
+		}
+	}
+
+	[string appendString:@"}\n"];
+	return string;
+}
+
+- (NSData *)JSONRepresentation {
+	NSMutableArray *nodes = [NSMutableArray array];
+
+	for (RCLProfilerNode *node in self.nodes) {
+		[nodes addObject:@{
+			@"id": node.identifier,
+			@"name": node.name,
+			@"geometryOperator": @(node.geometryOperator),
+			@"operands": node.operandIdentifiers,
+			@"evaluations": @(node.evaluationCount),
+			@"sent": @(node.sentCount),
+			@"suppressed": @(node.suppressedCount),
+			@"empty": @(node.emptyCount),
+			@"totalTime": @(node.totalTime),
+			@"peakTime": @(node.peakTime),
+		}];
+	}
+
+	NSError *error = nil;
+	NSData *data = [NSJSONSerialization dataWithJSONObject:@{ @"nodes": nodes } options:NSJSONWritingPrettyPrinted error:&error];
+	NSAssert(data != nil, @"Could not serialize profiler nodes: %@", error);
+
+	return data;
+}
+
+@end
+
+@implementation RCLProfilerRecord
+
+- (id)initWithIdentifier:(NSString *)identifier name:(NSString *)name geometryOperator:(BOOL)geometryOperator {
+	NSCParameterAssert(identifier != nil);
+	NSCParameterAssert(name != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_identifier = [identifier copy];
+	_name = [name copy];
+	_geometryOperator = geometryOperator;
+	_operandRecords = @[];
+
+	return self;
+}
+
+@end
+
+@implementation RCLProfilerNode
+
+- (id)initWithRecord:(RCLProfilerRecord *)record {
+	NSCParameterAssert(record != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_identifier = record.identifier;
+	_name = record.name;
+	_geometryOperator = record.geometryOperator;
+	_operandIdentifiers = [record.operandRecords valueForKey:@"identifier"];
+	_evaluationCount = record.evaluationCount;
+	_sentCount = record.sentCount;
+	_suppressedCount = record.suppressedCount;
+	_emptyCount = record.emptyCount;
+	_totalTime = RCLTimeIntervalFromMachDuration(record.totalDuration);
+	_peakTime = RCLTimeIntervalFromMachDuration(record.peakDuration);
+
+	return self;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p>{ identifier = %@, name = %@, evaluations = %lu, totalTime = %f }", self.class, self, self.identifier, self.name, (unsigned long)self.evaluationCount, self.totalTime];
+}
+
+@end
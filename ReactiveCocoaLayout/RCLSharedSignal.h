@@ -0,0 +1,31 @@
+//
+//  RCLSharedSignal.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <ReactiveCocoa/ReactiveCocoa.h>
+
+// Multicasts a signal to any number of subscribers, through a single
+// subscription.
+//
+// The underlying signal is subscribed to when the first subscriber arrives,
+// and disposed of when the last one leaves. While connected, the latest value
+// is sent to each new subscriber upon subscription. The latest value is
+// forgotten when disconnecting, so a later subscriber will read a new value
+// from the underlying signal, instead of a stale one.
+//
+// This differs from -[RACSignal replayLast], which connects immediately and
+// stays connected forever, and from -[RACMulticastConnection autoconnect],
+// which cannot reconnect once disposed. Both of those are unsuitable for
+// signals that are memoized on long-lived objects, like views.
+@interface RCLSharedSignal : RACSignal
+
+// Creates a signal that shares subscriptions to `signal`.
+//
+// signal - The signal to multicast. This must not be nil.
++ (instancetype)signalWithSignal:(RACSignal *)signal;
+
+@end
@@ -0,0 +1,159 @@
+//
+//  RCLSharedSignal.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLSharedSignal.h"
+
+@interface RCLSharedSignal ()
+
+// The signal being multicast.
+@property (nonatomic, strong, readonly) RACSignal *sourceSignal;
+
+// The subscribers currently attached to the receiver.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMutableArray *subscribers;
+
+// The subscription to `sourceSignal`, or nil if the receiver is not connected.
+//
+// Events from any other subscription are stale, and are ignored.
+//
+// This must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong) RACSerialDisposable *connection;
+
+// The latest value sent by `sourceSignal` over `connection`, if `hasLatestValue`
+// is YES.
+//
+// These must only be accessed while synchronized on the receiver.
+@property (nonatomic, strong) id latestValue;
+@property (nonatomic, assign) BOOL hasLatestValue;
+
+// Attaches `subscriber`, connecting to `sourceSignal` if necessary.
+//
+// Returns a disposable which will detach the subscriber.
+- (RACDisposable *)attachSubscriber:(id<RACSubscriber>)subscriber;
+
+// Detaches `subscriber`, disconnecting from `sourceSignal` if it was the last
+// one.
+- (void)detachSubscriber:(id<RACSubscriber>)subscriber;
+
+@end
+
+@implementation RCLSharedSignal
+
+#pragma mark Lifecycle
+
++ (instancetype)signalWithSignal:(RACSignal *)signal {
+	NSCParameterAssert(signal != nil);
+
+	RCLSharedSignal *shared = [[self alloc] init];
+	shared->_sourceSignal = signal;
+	shared->_subscribers = [NSMutableArray array];
+	return shared;
+}
+
+#pragma mark Subscription
+
+- (RACDisposable *)subscribe:(id<RACSubscriber>)subscriber {
+	NSCParameterAssert(subscriber != nil);
+
+	// Let RACDynamicSignal take care of the subscriber bookkeeping.
+	return [[RACSignal createSignal:^(id<RACSubscriber> sharedSubscriber) {
+		return [self attachSubscriber:sharedSubscriber];
+	}] subscribe:subscriber];
+}
+
+- (RACDisposable *)attachSubscriber:(id<RACSubscriber>)subscriber {
+	RACSerialDisposable *connection = nil;
+
+	// Like RACReplaySubject, events are sent while synchronized, so that the
+	// latest value can't be replayed after a newer value has been sent to the
+	// same subscriber.
+	@synchronized (self) {
+		[self.subscribers addObject:subscriber];
+
+		if (self.connection == nil) {
+			connection = [[RACSerialDisposable alloc] init];
+			self.connection = connection;
+		} else if (self.hasLatestValue) {
+			[subscriber sendNext:self.latestValue];
+		}
+	}
+
+	RACDisposable *detachDisposable = [RACDisposable disposableWithBlock:^{
+		[self detachSubscriber:subscriber];
+	}];
+
+	if (connection == nil) return detachDisposable;
+
+	// Returns the subscribers to send an event to, or nil if `connection` is
+	// stale.
+	//
+	// This must be invoked while synchronized on the receiver. Subscribers
+	// may detach while the event is being sent, so they're copied first.
+	NSArray * (^subscribersForEvent)(BOOL, id) = ^ NSArray * (BOOL terminating, id value) {
+		if (self.connection != connection) return nil;
+
+		NSArray *subscribers = [self.subscribers copy];
+		if (terminating) {
+			[self.subscribers removeAllObjects];
+			self.connection = nil;
+			self.latestValue = nil;
+			self.hasLatestValue = NO;
+		} else {
+			self.latestValue = value;
+			self.hasLatestValue = YES;
+		}
+
+		return subscribers;
+	};
+
+	// This may deliver the first value synchronously, to the subscriber
+	// attached above.
+	connection.disposable = [self.sourceSignal subscribeNext:^(id x) {
+		@synchronized (self) {
+			for (id<RACSubscriber> subscriber in subscribersForEvent(NO, x)) {
+				[subscriber sendNext:x];
+			}
+		}
+	} error:^(NSError *error) {
+		@synchronized (self) {
+			for (id<RACSubscriber> subscriber in subscribersForEvent(YES, nil)) {
+				[subscriber sendError:error];
+			}
+		}
+	} completed:^{
+		@synchronized (self) {
+			for (id<RACSubscriber> subscriber in subscribersForEvent(YES, nil)) {
+				[subscriber sendCompleted];
+			}
+		}
+	}];
+
+	return detachDisposable;
+}
+
+- (void)detachSubscriber:(id<RACSubscriber>)subscriber {
+	RACSerialDisposable *connection = nil;
+
+	@synchronized (self) {
+		NSUInteger index = [self.subscribers indexOfObjectIdenticalTo:subscriber];
+		if (index == NSNotFound) return;
+
+		[self.subscribers removeObjectAtIndex:index];
+		if (self.subscribers.count > 0) return;
+
+		connection = self.connection;
+		self.connection = nil;
+		self.latestValue = nil;
+		self.hasLatestValue = NO;
+	}
+
+	[connection dispose];
+}
+
+@end
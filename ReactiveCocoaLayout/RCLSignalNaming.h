@@ -0,0 +1,48 @@
+//
+//  RCLSignalNaming.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <ReactiveCocoa/ReactiveCocoa.h>
+
+// Creates a block which formats a signal name, for use with
+// -rcl_setNameWithBlock:. The arguments are the same as those of
+// +[NSString stringWithFormat:].
+//
+// The arguments are captured by the block, and are not formatted until the name
+// is actually read. Objects will be retained until then, so this should not be
+// given anything which could retain the named signal.
+//
+// If RCL_STRIP_SIGNAL_NAMES is defined to a non-zero value at compile time,
+// this evaluates to nil, and its arguments are never evaluated.
+#if RCL_STRIP_SIGNAL_NAMES
+	#define RCLName(...) nil
+#else
+	#define RCLName(...) \
+		^{ \
+			return [NSString stringWithFormat:__VA_ARGS__]; \
+		}
+#endif
+
+// Determines whether signals should be given names, based upon whether the
+// RAC_DEBUG_SIGNAL_NAMES environment variable is set.
+//
+// This matches the behavior of -[RACStream setNameWithFormat:].
+BOOL RCLSignalNamesEnabled(void);
+
+@interface RACStream (RCLSignalNaming)
+
+// Like -setNameWithFormat:, but defers formatting the name until it's read.
+//
+// block - A block which returns the name for the receiver, as created with
+//         RCLName(). This will be invoked at most once, the first time that
+//         the name is needed. If nil, or if RCLSignalNamesEnabled() returns
+//         NO, the name of the receiver is not changed.
+//
+// Returns the receiver, for chaining.
+- (instancetype)rcl_setNameWithBlock:(NSString * (^)(void))block;
+
+@end
@@ -0,0 +1,99 @@
+//
+//  RCLSignalNaming.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLSignalNaming.h"
+
+// A string which is only created from a block once it's first used.
+@interface RCLLazyString : NSString
+
+- (id)initWithBlock:(NSString * (^)(void))block;
+
+@end
+
+@interface RCLLazyString () {
+	// Creates the underlying string. This is set to nil after being invoked.
+	//
+	// This must only be accessed while synchronized on the receiver.
+	NSString * (^_block)(void);
+
+	// The underlying string, or nil if it hasn't been created yet.
+	//
+	// This must only be accessed while synchronized on the receiver.
+	NSString *_string;
+}
+
+// The underlying string, created upon first access.
+@property (nonatomic, copy, readonly) NSString *string;
+
+@end
+
+BOOL RCLSignalNamesEnabled(void) {
+	return getenv("RAC_DEBUG_SIGNAL_NAMES") != NULL;
+}
+
+@implementation RACStream (RCLSignalNaming)
+
+- (instancetype)rcl_setNameWithBlock:(NSString * (^)(void))block {
+	if (block == nil || !RCLSignalNamesEnabled()) return self;
+
+	self.name = [[RCLLazyString alloc] initWithBlock:block];
+	return self;
+}
+
+@end
+
+@implementation RCLLazyString
+
+#pragma mark Lifecycle
+
+- (id)initWithBlock:(NSString * (^)(void))block {
+	NSCParameterAssert(block != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_block = [block copy];
+
+	return self;
+}
+
+#pragma mark Properties
+
+- (NSString *)string {
+	@synchronized (self) {
+		if (_string == nil) {
+			_string = [_block() copy] ?: @"";
+			_block = nil;
+		}
+
+		return _string;
+	}
+}
+
+#pragma mark NSCopying
+
+- (id)copyWithZone:(NSZone *)zone {
+	// Immutable, and copying would force the string to be created.
+	return self;
+}
+
+#pragma mark NSString
+
+- (NSUInteger)length {
+	return self.string.length;
+}
+
+- (unichar)characterAtIndex:(NSUInteger)index {
+	return [self.string characterAtIndex:index];
+}
+
+- (void)getCharacters:(unichar *)buffer range:(NSRange)range {
+	[self.string getCharacters:buffer range:range];
+}
+
+@end
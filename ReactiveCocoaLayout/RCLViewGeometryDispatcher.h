@@ -0,0 +1,58 @@
+//
+//  RCLViewGeometryDispatcher.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <AppKit/AppKit.h>
+
+@class RACDisposable;
+
+// The kinds of geometry change which can be observed on a view.
+typedef enum : NSUInteger {
+	// NSViewFrameDidChangeNotification was posted for the view.
+	RCLViewGeometryChangeFrame = 1 << 0,
+
+	// NSViewBoundsDidChangeNotification was posted for the view.
+	RCLViewGeometryChangeBounds = 1 << 1
+} RCLViewGeometryChange;
+
+// Observes the frame and bounds notifications of every view in the process,
+// and forwards them to blocks registered for individual views.
+//
+// This replaces an NSNotificationCenter observer for each view and
+// notification with one observer for each notification, and a lookup into
+// a table keyed by view.
+//
+// Every view's notifications pass through the dispatcher, so the table is
+// read without taking a lock. In exchange, each change to the observations
+// copies the table, and so takes time proportional to the number of observed
+// views. Views are only observed once for each signal created for them, so
+// this is much rarer than notifications.
+//
+// Notifications are dispatched on the thread that posted them. Blocks are
+// invoked outside of any locks, so they may add or remove observations.
+@interface RCLViewGeometryDispatcher : NSObject
+
+// Returns the dispatcher used by all views.
++ (instancetype)sharedDispatcher;
+
+// Invokes `block` whenever the given changes are posted for `view`.
+//
+// This does not change whether the view posts notifications. Callers should
+// set `postsFrameChangedNotifications` and `postsBoundsChangedNotifications`
+// as needed.
+//
+// view    - The view to observe. This is not retained. Observations are
+//           removed automatically when the view is deallocated. This must
+//           not be nil.
+// changes - A mask of the changes to observe. This must not be zero.
+// block   - Invoked with the view and the kind of change, for each matching
+//           notification. This must not be nil.
+//
+// Returns a disposable which can be used to stop observing.
+- (RACDisposable *)observeView:(NSView *)view changes:(RCLViewGeometryChange)changes block:(void (^)(NSView *view, RCLViewGeometryChange change))block;
+
+@end
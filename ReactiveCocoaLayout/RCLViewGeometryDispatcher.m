@@ -0,0 +1,164 @@
+//
+//  RCLViewGeometryDispatcher.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLViewGeometryDispatcher.h"
+#import <ReactiveCocoa/ReactiveCocoa.h>
+
+// One block registered with -observeView:changes:block:.
+@interface RCLViewGeometryObservation : NSObject
+
+@property (nonatomic, assign, readonly) RCLViewGeometryChange changes;
+@property (nonatomic, copy, readonly) void (^block)(NSView *view, RCLViewGeometryChange change);
+
+- (id)initWithChanges:(RCLViewGeometryChange)changes block:(void (^)(NSView *view, RCLViewGeometryChange change))block;
+
+@end
+
+@interface RCLViewGeometryDispatcher ()
+
+// The RCLViewGeometryObservations for each view, as NSArrays.
+//
+// Views are keyed by address, and not retained.
+//
+// Notifications read this without locking, so the table and its arrays must
+// never be mutated once they've been set. Instead, a modified copy is set
+// while synchronized on the receiver.
+@property (atomic, strong) NSMapTable *observationsByView;
+
+@end
+
+@implementation RCLViewGeometryDispatcher
+
+#pragma mark Lifecycle
+
++ (instancetype)sharedDispatcher {
+	static id singleton;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		singleton = [[self alloc] init];
+	});
+
+	return singleton;
+}
+
+- (id)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_observationsByView = [self.class observationTable];
+
+	[NSNotificationCenter.defaultCenter addObserver:self selector:@selector(viewGeometryDidChange:) name:NSViewFrameDidChangeNotification object:nil];
+	[NSNotificationCenter.defaultCenter addObserver:self selector:@selector(viewGeometryDidChange:) name:NSViewBoundsDidChangeNotification object:nil];
+
+	return self;
+}
+
+- (void)dealloc {
+	[NSNotificationCenter.defaultCenter removeObserver:self];
+}
+
+#pragma mark Observation
+
+// Creates an empty table suitable for `observationsByView`.
++ (NSMapTable *)observationTable {
+	return [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsOpaquePersonality valueOptions:NSPointerFunctionsStrongMemory capacity:0];
+}
+
+// Replaces the observations of the view at `viewAddress`, by setting a copy of
+// `observationsByView`.
+//
+// This must be invoked while synchronized on the receiver.
+//
+// observations - The new observations of the view. If nil, the view is
+//                removed from the table.
+- (void)setObservations:(NSArray *)observations forViewAtAddress:(const void *)viewAddress {
+	NSMapTable *observationsByView = [self.class observationTable];
+
+	for (NSMapEnumerator enumerator = NSEnumerateMapTable(self.observationsByView);;) {
+		void *key = NULL;
+		void *value = NULL;
+		if (!NSNextMapEnumeratorPair(&enumerator, &key, &value)) {
+			NSEndMapTableEnumeration(&enumerator);
+			break;
+		}
+
+		if (key != viewAddress) NSMapInsertKnownAbsent(observationsByView, key, value);
+	}
+
+	if (observations != nil) NSMapInsertKnownAbsent(observationsByView, viewAddress, (__bridge void *)[observations copy]);
+
+	self.observationsByView = observationsByView;
+}
+
+- (RACDisposable *)observeView:(NSView *)view changes:(RCLViewGeometryChange)changes block:(void (^)(NSView *, RCLViewGeometryChange))block {
+	NSParameterAssert(view != nil);
+	NSParameterAssert(changes != 0);
+	NSParameterAssert(block != nil);
+
+	RCLViewGeometryObservation *observation = [[RCLViewGeometryObservation alloc] initWithChanges:changes block:block];
+
+	// Only used for its address after this point.
+	__unsafe_unretained NSView *unretainedView = view;
+	const void *viewAddress = (__bridge void *)view;
+
+	BOOL firstObservation = NO;
+	@synchronized (self) {
+		NSArray *observations = [self.observationsByView objectForKey:unretainedView];
+		firstObservation = (observations == nil);
+
+		[self setObservations:[(observations ?: @[]) arrayByAddingObject:observation] forViewAtAddress:viewAddress];
+	}
+
+	if (firstObservation) {
+		[view.rac_deallocDisposable addDisposable:[RACDisposable disposableWithBlock:^{
+			@synchronized (self) {
+				[self setObservations:nil forViewAtAddress:viewAddress];
+			}
+		}]];
+	}
+
+	return [RACDisposable disposableWithBlock:^{
+		@synchronized (self) {
+			NSMutableArray *observations = [[self.observationsByView objectForKey:unretainedView] mutableCopy];
+			if (observations == nil) return;
+
+			[observations removeObjectIdenticalTo:observation];
+			[self setObservations:observations forViewAtAddress:viewAddress];
+		}
+	}];
+}
+
+- (void)viewGeometryDidChange:(NSNotification *)notification {
+	NSView *view = notification.object;
+
+	// Most views aren't observed, so check for them without taking a lock.
+	NSArray *observations = [self.observationsByView objectForKey:view];
+	if (observations.count == 0) return;
+
+	RCLViewGeometryChange change = ([notification.name isEqualToString:NSViewFrameDidChangeNotification] ? RCLViewGeometryChangeFrame : RCLViewGeometryChangeBounds);
+
+	for (RCLViewGeometryObservation *observation in observations) {
+		if ((observation.changes & change) != 0) observation.block(view, change);
+	}
+}
+
+@end
+
+@implementation RCLViewGeometryObservation
+
+- (id)initWithChanges:(RCLViewGeometryChange)changes block:(void (^)(NSView *, RCLViewGeometryChange))block {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_changes = changes;
+	_block = [block copy];
+
+	return self;
+}
+
+@end
@@ -19,7 +19,10 @@ FOUNDATION_EXPORT const unsigned char ReactiveCocoaLayoutVersionString[];
 #import <ReactiveCocoaLayout/RACSignal+RCLAnimationAdditions.h>
 #import <ReactiveCocoaLayout/RACSignal+RCLGeometryAdditions.h>
 #import <ReactiveCocoaLayout/RACSignal+RCLWritingDirectionAdditions.h>
+#import <ReactiveCocoaLayout/RCLGeometryCore.h>
+#import <ReactiveCocoaLayout/RCLGeometryKernels.h>
 #import <ReactiveCocoaLayout/RCLMacros.h>
+#import <ReactiveCocoaLayout/RCLProfiler.h>
 #import <ReactiveCocoaLayout/View+RCLAutoLayoutAdditions.h>
 
 #ifdef RCL_FOR_IPHONE
@@ -25,7 +25,8 @@
 // The receiver's current frame.
 //
 // Setting this property to a given rect will automatically align the rect with
-// pixels on the screen.
+// pixels on the screen. A rect which aligns to the current frame is not
+// assigned at all.
 //
 // This property may have `RAC()` bindings applied to it, but it is not
 // KVO-compliant. Use -rcl_frameSignal for observing changes instead.
@@ -34,7 +35,8 @@
 // The receiver's current bounds.
 //
 // Setting this property to a given rect will automatically align the rect with
-// pixels on the screen.
+// pixels on the screen. A rect which aligns to the current bounds is not
+// assigned at all.
 //
 // This property may have `RAC()` bindings applied to it, but it is not
 // KVO-compliant. Use -rcl_boundsSignal for observing changes instead.
@@ -56,6 +58,11 @@
 // -viewForBaselineLayout, and recalculates the offset of the baseline from the
 // maximum Y edge whenever either changes.
 //
+// The same signal is returned each time, and shares one computation between
+// all of its subscribers. If the receiver's class overrides
+// -viewForBaselineLayout, it's read again whenever the receiver's bounds or
+// frame change, or KVO notifications are posted for it.
+//
 // **Note:** This method may sometimes return incorrect results because
 // -viewForBaselineLayout isn't actually intended to be used outside of Auto
 // Layout. See http://www.openradar.me/radar?id=2468401 for more information.
@@ -8,7 +8,10 @@
 
 #import "UIView+RCLGeometryAdditions.h"
 #import "RACSignal+RCLGeometryAdditions.h"
+#import "RCLGeometrySignal.h"
+#import "RCLSharedSignal.h"
 #import <Archimedes/Archimedes.h>
+#import <objc/runtime.h>
 #import <ReactiveCocoa/EXTScope.h>
 #import <ReactiveCocoa/ReactiveCocoa.h>
 
@@ -53,7 +56,13 @@ static CGRect backingAlignedRect(UIView *view, CGRect rect) {
 }
 
 - (void)setRcl_frame:(CGRect)frame {
-	self.frame = backingAlignedRect(self, frame);
+	frame = backingAlignedRect(self, frame);
+
+	// Rects which round to the same device pixels as the current frame would
+	// only cause a redundant layout pass.
+	if (CGRectEqualToRect(frame, self.frame)) return;
+
+	self.frame = frame;
 }
 
 - (CGRect)rcl_bounds {
@@ -61,7 +70,10 @@ static CGRect backingAlignedRect(UIView *view, CGRect rect) {
 }
 
 - (void)setRcl_bounds:(CGRect)bounds {
-	self.bounds = backingAlignedRect(self, bounds);
+	bounds = backingAlignedRect(self, bounds);
+	if (CGRectEqualToRect(bounds, self.bounds)) return;
+
+	self.bounds = bounds;
 }
 
 #pragma mark Signals
@@ -71,49 +83,82 @@ static CGRect backingAlignedRect(UIView *view, CGRect rect) {
 - (RACSignal *)rcl_boundsSignal {
 	@weakify(self);
 
-	return [[[RACObserve(self, layer.bounds)
-		map:^(id _) {
-			@strongify(self);
-			return MEDBox(self.bounds);
-		}]
-		distinctUntilChanged]
-		setNameWithFormat:@"%@ -rcl_boundsSignal", self];
+	RCLGeometrySignal *signal = [RCLGeometrySignal signalWithOperands:@[ RACObserve(self, layer.bounds) ] operation:^(const RCLGeometry *values) {
+		@strongify(self);
+		return RCLGeometryMakeRect(self.bounds);
+	}];
+
+	// Compare bounds before boxing them, so that unchanged bounds don't
+	// allocate anything. Being distinct also keeps background layout from
+	// evaluating this off the main thread.
+	return [[signal distinctWithTolerance:0] setNameWithFormat:@"%@ -rcl_boundsSignal", self];
 }
 
 - (RACSignal *)rcl_frameSignal {
 	@weakify(self);
 
-	return [[[[RACSignal
-		merge:@[ self.rcl_boundsSignal, RACObserve(self, layer.position) ]]
-		map:^(id _) {
-			@strongify(self);
-			return MEDBox(self.frame);
-		}]
-		distinctUntilChanged]
-		setNameWithFormat:@"%@ -rcl_frameSignal", self];
+	RACSignal *changes = [RACSignal merge:@[ self.rcl_boundsSignal, RACObserve(self, layer.position) ]];
+
+	RCLGeometrySignal *signal = [RCLGeometrySignal signalWithOperands:@[ changes ] operation:^(const RCLGeometry *values) {
+		@strongify(self);
+		return RCLGeometryMakeRect(self.frame);
+	}];
+
+	return [[signal distinctWithTolerance:0] setNameWithFormat:@"%@ -rcl_frameSignal", self];
 }
 
 - (RACSignal *)rcl_baselineSignal {
-	RACSignal *signal;
-
-	if (self.viewForBaselineLayout == self) {
-		// The baseline will always be the bottom of our bounds.
-		signal = [RACSignal return:@0];
+	RACSignal *signal = objc_getAssociatedObject(self, _cmd);
+	if (signal != nil) return signal;
+
+	SEL baselineViewSelector = @selector(viewForBaselineLayout);
+	if (class_getMethodImplementation(self.class, baselineViewSelector) == class_getMethodImplementation(UIView.class, baselineViewSelector)) {
+		// UIView's implementation always returns the receiver, so the
+		// baseline will always be the bottom of our bounds.
+		signal = RACSignal.zero;
 	} else {
 		@weakify(self);
-		signal = [[RACSignal
-			merge:@[ self.rcl_boundsSignal, self.rcl_frameSignal, self.viewForBaselineLayout.rcl_frameSignal ]]
+
+		RACSignal *changes = [RACSignal merge:@[ self.rcl_boundsSignal, self.rcl_frameSignal ]];
+
+		// -viewForBaselineLayout may return a different view at any time, so
+		// ask again whenever the receiver changes, or posts KVO notifications
+		// for it.
+		RACSignal *baselineViews = [[[RACSignal
+			merge:@[ changes, RACObserve(self, viewForBaselineLayout) ]]
 			map:^(id _) {
 				@strongify(self);
+				return self.viewForBaselineLayout;
+			}]
+			distinctUntilChanged];
+
+		RACSignal *baselines = [[[baselineViews
+			map:^ RACSignal * (UIView *baselineView) {
+				@strongify(self);
+				if (baselineView == self || baselineView == nil) return RACSignal.zero;
 
-				UIView *baselineView = self.viewForBaselineLayout;
-				NSAssert([baselineView.superview isEqual:self], @"%@ must be a subview of %@ to be its viewForBaselineLayout", baselineView, self);
+				@weakify(baselineView);
 
-				return @(CGRectGetHeight(self.bounds) - CGRectGetMaxY(baselineView.frame));
-			}].distinctUntilChanged;
+				RACSignal *baselineChanges = [RACSignal merge:@[ changes, baselineView.rcl_frameSignal ]];
+				return [[RCLGeometrySignal signalWithOperands:@[ baselineChanges ] operation:^(const RCLGeometry *values) {
+					@strongify(self, baselineView);
+					NSAssert([baselineView.superview isEqual:self], @"%@ must be a subview of %@ to be its viewForBaselineLayout", baselineView, self);
+
+					return RCLGeometryMakeNumber(CGRectGetHeight(self.bounds) - CGRectGetMaxY(baselineView.frame));
+				}] distinctWithTolerance:0];
+			}]
+			switchToLatest]
+			distinctUntilChanged];
+
+		// Baselines are often requested by several sibling views, so share
+		// one computation between all of them.
+		signal = [RCLSharedSignal signalWithSignal:baselines];
 	}
 
-	return [signal setNameWithFormat:@"%@ -rcl_baselineSignal", self];
+	signal = [signal setNameWithFormat:@"%@ -rcl_baselineSignal", self];
+	objc_setAssociatedObject(self, _cmd, signal, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+
+	return signal;
 }
 
 @end
@@ -41,7 +41,8 @@
 //
 // Returns a signal which sends the current alignment rect, and a new CGRect
 // every time the view's frame changes in a way that might affect the alignment
-// rect.
+// rect. The same signal is returned each time, and shares one computation
+// between all of its subscribers.
 - (RACSignal *)rcl_alignmentRectSignal;
 
 @end
@@ -8,6 +8,8 @@
 
 #import "View+RCLAutoLayoutAdditions.h"
 #import "RACSignal+RCLGeometryAdditions.h"
+#import "RCLGeometrySignal.h"
+#import "RCLSharedSignal.h"
 #import <Archimedes/Archimedes.h>
 #import <objc/runtime.h>
 #import <ReactiveCocoa/EXTScope.h>
@@ -19,78 +21,90 @@
 #import "NSView+RCLGeometryAdditions.h"
 #endif
 
-// Associated with a RACSubject which sends -intrinsicContentSize whenever
-// -invalidateIntrinsicContentSize is invoked.
-static void *IntrinsicContentSizeSubjectKey = &IntrinsicContentSizeSubjectKey;
-
-static void (*oldInvalidateIntrinsicContentSize)(id, SEL);
-static void newInvalidateIntrinsicContentSize(id self, SEL _cmd) {
-	oldInvalidateIntrinsicContentSize(self, _cmd);
-
-	RACSubject *subject = objc_getAssociatedObject(self, IntrinsicContentSizeSubjectKey);
-	if (subject == nil) return;
-
-	[subject sendNext:MEDBox([self intrinsicContentSize])];
-}
-
 #ifdef RCL_FOR_IPHONE
 @implementation UIView (RCLAutoLayoutAdditions)
 #else
 @implementation NSView (RCLAutoLayoutAdditions)
 #endif
 
-#pragma mark Lifecycle
-
-+ (void)load {
-	SEL selector = @selector(invalidateIntrinsicContentSize);
-
-	Method method = class_getInstanceMethod(self, selector);
-	NSAssert(method != NULL, @"Could not find %@ on %@", NSStringFromSelector(selector), self);
-
-	oldInvalidateIntrinsicContentSize = (__typeof__(oldInvalidateIntrinsicContentSize))method_getImplementation(method);
-	class_replaceMethod(self, selector, (IMP)&newInvalidateIntrinsicContentSize, method_getTypeEncoding(method));
-}
-
 #pragma mark Signals
 
 - (RACSignal *)rcl_intrinsicContentSizeSignal {
-	RACSubject *subject = objc_getAssociatedObject(self, IntrinsicContentSizeSubjectKey);
-	if (subject == nil) {
-		subject = [RACReplaySubject replaySubjectWithCapacity:1];
-		[subject sendNext:MEDBox(self.intrinsicContentSize)];
+	RACSignal *signal = objc_getAssociatedObject(self, _cmd);
+	if (signal != nil) return signal;
 
-		objc_setAssociatedObject(self, IntrinsicContentSizeSubjectKey, subject, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	RACSubject *subject = [RACReplaySubject replaySubjectWithCapacity:1];
+	[subject sendNext:MEDBox(self.intrinsicContentSize)];
 
-		[self.rac_deallocDisposable addDisposable:[RACDisposable disposableWithBlock:^{
-			[subject sendCompleted];
-		}]];
-	}
+	@unsafeify(self);
 
-	return [[subject distinctUntilChanged] setNameWithFormat:@"%@ -rcl_intrinsicContentSizeSignal", self];
+	// Only hook -invalidateIntrinsicContentSize on the receiver, so that
+	// views which are never observed don't pay anything to invalidate. This
+	// completes when the receiver deallocates.
+	[[[self rac_signalForSelector:@selector(invalidateIntrinsicContentSize)]
+		map:^(id _) {
+			@strongify(self);
+			return MEDBox(self.intrinsicContentSize);
+		}]
+		subscribe:subject];
+
+	// The signal only captures the subject, so it can be memoized without
+	// retaining the view.
+	signal = [[subject distinctUntilChanged] setNameWithFormat:@"%@ -rcl_intrinsicContentSizeSignal", self];
+	objc_setAssociatedObject(self, _cmd, signal, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+
+	return signal;
 }
 
 - (RACSignal *)rcl_intrinsicBoundsSignal {
-	return [[RACSignal rectsWithSize:self.rcl_intrinsicContentSizeSignal] setNameWithFormat:@"%@ -rcl_intrinsicBoundsSignal", self];
+	RACSignal *signal = objc_getAssociatedObject(self, _cmd);
+	if (signal == nil) {
+		signal = [[RACSignal rectsWithSize:self.rcl_intrinsicContentSizeSignal] setNameWithFormat:@"%@ -rcl_intrinsicBoundsSignal", self];
+		objc_setAssociatedObject(self, _cmd, signal, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	}
+
+	return signal;
 }
 
 - (RACSignal *)rcl_intrinsicHeightSignal {
-	return [self.rcl_intrinsicContentSizeSignal.height setNameWithFormat:@"%@ -rcl_intrinsicHeightSignal", self];
+	RACSignal *signal = objc_getAssociatedObject(self, _cmd);
+	if (signal == nil) {
+		signal = [self.rcl_intrinsicContentSizeSignal.height setNameWithFormat:@"%@ -rcl_intrinsicHeightSignal", self];
+		objc_setAssociatedObject(self, _cmd, signal, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	}
+
+	return signal;
 }
 
 - (RACSignal *)rcl_intrinsicWidthSignal {
-	return [self.rcl_intrinsicContentSizeSignal.width setNameWithFormat:@"%@ -rcl_intrinsicWidthSignal", self];
+	RACSignal *signal = objc_getAssociatedObject(self, _cmd);
+	if (signal == nil) {
+		signal = [self.rcl_intrinsicContentSizeSignal.width setNameWithFormat:@"%@ -rcl_intrinsicWidthSignal", self];
+		objc_setAssociatedObject(self, _cmd, signal, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+	}
+
+	return signal;
 }
 
 - (RACSignal *)rcl_alignmentRectSignal {
+	RACSignal *signal = objc_getAssociatedObject(self, _cmd);
+	if (signal != nil) return signal;
+
 	@unsafeify(self);
 
-	return [[[self.rcl_frameSignal
-		map:^(id _) {
-			@strongify(self);
-			return MEDBox(self.rcl_alignmentRect);
-		}]
-		distinctUntilChanged]
-		setNameWithFormat:@"%@ -rcl_alignmentRectSignal", self];
+	// Alignment rects are in the superview's coordinates, so they change
+	// with every frame that's sent. Being distinct keeps this view-backed
+	// stage from being fused into the operators that use it, or from being
+	// read off the main thread by background layout.
+	RACSignal *alignmentRects = [[RCLGeometrySignal signalWithOperands:@[ self.rcl_frameSignal ] operation:^(const RCLGeometry *values) {
+		@strongify(self);
+		return RCLGeometryMakeRect(self.rcl_alignmentRect);
+	}] distinctWithTolerance:0];
+
+	signal = [[RCLSharedSignal signalWithSignal:alignmentRects] setNameWithFormat:@"%@ -rcl_alignmentRectSignal", self];
+	objc_setAssociatedObject(self, _cmd, signal, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+
+	return signal;
 }
 
 @end
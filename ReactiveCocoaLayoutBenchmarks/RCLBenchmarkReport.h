@@ -0,0 +1,84 @@
+//
+//  RCLBenchmarkReport.h
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// The name of the environment variable which, if set, specifies the path that
+// the shared report should be written to as JSON.
+extern NSString * const RCLBenchmarkReportPathEnvironmentKey;
+
+// The measurements taken for one kind of binding.
+@interface RCLBenchmarkResult : NSObject
+
+// The name of the benchmark, unique within its report.
+@property (nonatomic, copy, readonly) NSString *name;
+
+// The number of bindings constructed and updated for each measurement.
+@property (nonatomic, assign, readonly) NSUInteger bindingCount;
+
+// The mean time taken to construct (and subscribe to) a single binding.
+@property (nonatomic, assign, readonly) NSTimeInterval constructionTime;
+
+// The mean time taken for a single update to propagate through a single
+// binding.
+@property (nonatomic, assign, readonly) NSTimeInterval updateTime;
+
+// The mean number of values boxed by geometry operators for each update of
+// a single binding.
+//
+// Boxing is the main allocation that geometry operators make for an update,
+// so this tracks the allocations per update. See -[RCLProfiler boxedValueCount].
+@property (nonatomic, assign, readonly) double boxedValuesPerUpdate;
+
+// The mean number of bytes of memory retained by a single binding, after it
+// has been constructed and has received its first values.
+@property (nonatomic, assign, readonly) double bytesRetainedPerBinding;
+
+@end
+
+// Collects RCLBenchmarkResults, so that they can be compared between runs.
+@interface RCLBenchmarkReport : NSObject
+
+// Returns the report which all benchmarks record into.
++ (instancetype)sharedReport;
+
+// The results recorded so far, sorted by name.
+@property (atomic, copy, readonly) NSArray *results;
+
+// Constructs a number of bindings, then updates all of them a number of times,
+// and records the measurements taken.
+//
+// name           - The name of the benchmark. This must not be nil. Any result
+//                  previously recorded with the same name is replaced.
+// bindingCount   - The number of bindings to construct. This must be greater
+//                  than zero.
+// updateCount    - The number of times to invoke `updateBlock` while timing
+//                  updates, and again while counting boxed values. This must
+//                  be greater than zero.
+// bindingBlock   - Constructs and subscribes to the binding at the given
+//                  index, and returns an object that keeps it alive, such as
+//                  the RACDisposable for the subscription. This must not be
+//                  nil.
+// updateBlock    - Sends new values to the inputs of every binding. This must
+//                  not be nil.
+//
+// Returns the recorded result.
+- (RCLBenchmarkResult *)measureBenchmarkNamed:(NSString *)name bindingCount:(NSUInteger)bindingCount updateCount:(NSUInteger)updateCount bindingBlock:(id (^)(NSUInteger index))bindingBlock updateBlock:(void (^)(NSUInteger iteration))updateBlock;
+
+// Returns a JSON object containing a `results` array, where each element
+// describes one RCLBenchmarkResult. Times are given in seconds.
+- (NSData *)JSONRepresentation;
+
+// Writes the JSON representation of the receiver to the path specified by
+// RCLBenchmarkReportPathEnvironmentKey. Does nothing if the variable is not
+// set.
+//
+// Returns whether the report was written successfully, or not written at all.
+- (BOOL)writeIfRequested:(NSError **)error;
+
+@end
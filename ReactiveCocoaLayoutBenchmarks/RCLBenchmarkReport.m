@@ -0,0 +1,198 @@
+//
+//  RCLBenchmarkReport.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLBenchmarkReport.h"
+#import <ReactiveCocoa/ReactiveCocoa.h>
+#import <ReactiveCocoaLayout/ReactiveCocoaLayout.h>
+#import <mach/mach_time.h>
+#import <malloc/malloc.h>
+
+NSString * const RCLBenchmarkReportPathEnvironmentKey = @"RCL_BENCHMARK_REPORT_PATH";
+
+// Returns the current time, in seconds, from a monotonic clock.
+static NSTimeInterval currentTime(void) {
+	static mach_timebase_info_data_t timebase;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		mach_timebase_info(&timebase);
+	});
+
+	return (NSTimeInterval)mach_absolute_time() * timebase.numer / timebase.denom / NSEC_PER_SEC;
+}
+
+// Returns the number of bytes currently allocated with malloc(), across all
+// zones.
+static size_t bytesInUse(void) {
+	malloc_statistics_t statistics;
+	malloc_zone_statistics(NULL, &statistics);
+	return statistics.size_in_use;
+}
+
+@interface RCLBenchmarkResult ()
+
+@property (nonatomic, copy, readwrite) NSString *name;
+@property (nonatomic, assign, readwrite) NSUInteger bindingCount;
+@property (nonatomic, assign, readwrite) NSTimeInterval constructionTime;
+@property (nonatomic, assign, readwrite) NSTimeInterval updateTime;
+@property (nonatomic, assign, readwrite) double boxedValuesPerUpdate;
+@property (nonatomic, assign, readwrite) double bytesRetainedPerBinding;
+
+@end
+
+@interface RCLBenchmarkReport ()
+
+// The recorded results, keyed by name.
+//
+// This should only be used while synchronized on the receiver.
+@property (nonatomic, strong, readonly) NSMutableDictionary *resultsByName;
+
+@end
+
+@implementation RCLBenchmarkReport
+
+#pragma mark Lifecycle
+
++ (instancetype)sharedReport {
+	static id singleton;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		singleton = [[self alloc] init];
+	});
+
+	return singleton;
+}
+
+- (id)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_resultsByName = [NSMutableDictionary dictionary];
+
+	return self;
+}
+
+#pragma mark Results
+
+- (NSArray *)results {
+	@synchronized (self) {
+		NSSortDescriptor *descriptor = [NSSortDescriptor sortDescriptorWithKey:@"name" ascending:YES];
+		return [self.resultsByName.allValues sortedArrayUsingDescriptors:@[ descriptor ]];
+	}
+}
+
+#pragma mark Measurement
+
+- (RCLBenchmarkResult *)measureBenchmarkNamed:(NSString *)name bindingCount:(NSUInteger)bindingCount updateCount:(NSUInteger)updateCount bindingBlock:(id (^)(NSUInteger))bindingBlock updateBlock:(void (^)(NSUInteger))updateBlock {
+	NSParameterAssert(name != nil);
+	NSParameterAssert(bindingCount > 0);
+	NSParameterAssert(updateCount > 0);
+	NSParameterAssert(bindingBlock != nil);
+	NSParameterAssert(updateBlock != nil);
+
+	RCLBenchmarkResult *result = [[RCLBenchmarkResult alloc] init];
+	result.name = name;
+	result.bindingCount = bindingCount;
+
+	NSMutableArray *bindings = [NSMutableArray arrayWithCapacity:bindingCount];
+
+	size_t bytesBefore = bytesInUse();
+	NSTimeInterval start = currentTime();
+
+	@autoreleasepool {
+		for (NSUInteger i = 0; i < bindingCount; i++) {
+			id binding = bindingBlock(i);
+			NSAssert(binding != nil, @"Binding block for %@ returned nil", name);
+
+			[bindings addObject:binding];
+		}
+	}
+
+	result.constructionTime = (currentTime() - start) / bindingCount;
+
+	result.bytesRetainedPerBinding = ((double)bytesInUse() - bytesBefore) / bindingCount;
+
+	start = currentTime();
+
+	for (NSUInteger i = 0; i < updateCount; i++) {
+		@autoreleasepool {
+			updateBlock(i);
+		}
+	}
+
+	result.updateTime = (currentTime() - start) / updateCount / bindingCount;
+
+	// Boxed values are only counted while profiling, which would skew the
+	// timing above, so count them in a separate pass.
+	RCLProfiler *profiler = RCLProfiler.sharedProfiler;
+	[profiler reset];
+	profiler.enabled = YES;
+
+	// Continue the iterations, so that every update still sends new values.
+	for (NSUInteger i = updateCount; i < updateCount * 2; i++) {
+		@autoreleasepool {
+			updateBlock(i);
+		}
+	}
+
+	result.boxedValuesPerUpdate = (double)profiler.boxedValueCount / updateCount / bindingCount;
+
+	profiler.enabled = NO;
+	[profiler reset];
+
+	for (id binding in bindings) {
+		if ([binding isKindOfClass:RACDisposable.class]) [binding dispose];
+	}
+
+	@synchronized (self) {
+		self.resultsByName[name] = result;
+	}
+
+	return result;
+}
+
+#pragma mark Serialization
+
+- (NSData *)JSONRepresentation {
+	NSMutableArray *results = [NSMutableArray array];
+
+	for (RCLBenchmarkResult *result in self.results) {
+		[results addObject:@{
+			@"name": result.name,
+			@"bindings": @(result.bindingCount),
+			@"constructionTime": @(result.constructionTime),
+			@"updateTime": @(result.updateTime),
+			@"boxedValuesPerUpdate": @(result.boxedValuesPerUpdate),
+			@"bytesRetainedPerBinding": @(result.bytesRetainedPerBinding),
+		}];
+	}
+
+	NSError *error = nil;
+	NSData *data = [NSJSONSerialization dataWithJSONObject:@{ @"results": results } options:NSJSONWritingPrettyPrinted error:&error];
+	NSAssert(data != nil, @"Could not serialize benchmark results: %@", error);
+
+	return data;
+}
+
+- (BOOL)writeIfRequested:(NSError **)error {
+	NSString *path = NSProcessInfo.processInfo.environment[RCLBenchmarkReportPathEnvironmentKey];
+	if (path.length == 0) return YES;
+
+	return [self.JSONRepresentation writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
+
+@implementation RCLBenchmarkResult
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p>{ name = %@, constructionTime = %g, updateTime = %g, boxedValuesPerUpdate = %g, bytesRetainedPerBinding = %g }", self.class, self, self.name, self.constructionTime, self.updateTime, self.boxedValuesPerUpdate, self.bytesRetainedPerBinding];
+}
+
+@end
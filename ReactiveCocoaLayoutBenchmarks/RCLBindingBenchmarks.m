@@ -0,0 +1,151 @@
+//
+//  RCLBindingBenchmarks.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLBenchmarkReport.h"
+#import <Archimedes/Archimedes.h>
+#import <ReactiveCocoa/ReactiveCocoa.h>
+#import <ReactiveCocoaLayout/ReactiveCocoaLayout.h>
+#import <XCTest/XCTest.h>
+
+// The number of views bound for each benchmark.
+static const NSUInteger RCLBindingViewCount = 500;
+
+// The number of updates sent to each binding.
+static const NSUInteger RCLBindingUpdateCount = 50;
+
+// Creates the RCLFrame dictionary to bind a view with, given signals that
+// resemble a typical layout's inputs.
+typedef NSDictionary * (^RCLBindingsBlock)(RACSignal *containerRect, RACSignal *padding, RACSignal *siblingView);
+
+@interface RCLBindingBenchmarks : XCTestCase
+
+@end
+
+@implementation RCLBindingBenchmarks
+
+#pragma mark Lifecycle
+
++ (void)tearDown {
+	NSError *error = nil;
+	if (![RCLBenchmarkReport.sharedReport writeIfRequested:&error]) {
+		NSLog(@"Could not write benchmark report: %@", error);
+	}
+
+	[super tearDown];
+}
+
+#pragma mark Helpers
+
+// Binds RCLBindingViewCount views, then sends RCLBindingUpdateCount new
+// container rects and paddings.
+//
+// name          - The name of the benchmark.
+// useAlignment  - Whether to bind with RCLAlignment, instead of RCLFrame.
+// bindingsBlock - Creates the bindings for each view.
+- (void)measureBindingNamed:(NSString *)name useAlignment:(BOOL)useAlignment bindingsBlock:(RCLBindingsBlock)bindingsBlock {
+	RACSubject *containerRect = [RACReplaySubject replaySubjectWithCapacity:1];
+	RACSubject *padding = [RACReplaySubject replaySubjectWithCapacity:1];
+
+	[containerRect sendNext:[NSValue med_valueWithRect:CGRectMake(0, 0, 320, 480)]];
+	[padding sendNext:@8];
+
+	NSView *siblingView = [[NSView alloc] initWithFrame:CGRectMake(0, 0, 100, 20)];
+	RACSignal *siblingViewSignal = [RACSignal return:siblingView];
+
+	__block NSView *lastView = nil;
+
+	RCLBenchmarkResult *result = [RCLBenchmarkReport.sharedReport
+		measureBenchmarkNamed:[@"binding." stringByAppendingString:name]
+		bindingCount:RCLBindingViewCount
+		updateCount:RCLBindingUpdateCount
+		bindingBlock:^ id (NSUInteger index) {
+			NSView *view = [[NSView alloc] initWithFrame:CGRectZero];
+			NSDictionary *bindings = bindingsBlock(containerRect, padding, siblingViewSignal);
+
+			if (useAlignment) {
+				RCLAlignment(view) = bindings;
+			} else {
+				RCLFrame(view) = bindings;
+			}
+
+			lastView = view;
+			return view;
+		}
+		updateBlock:^(NSUInteger iteration) {
+			RCLPerformLayoutTransaction(^{
+				[containerRect sendNext:[NSValue med_valueWithRect:CGRectMake(0, 0, 320 + iteration, 480 + iteration)]];
+				[padding sendNext:@(8 + iteration % 4)];
+			});
+		}];
+
+	XCTAssertFalse(CGRectEqualToRect(lastView.frame, CGRectZero), @"Expected %@ to lay out its views", name);
+	NSLog(@"%@", result);
+}
+
+#pragma mark Benchmarks
+
+- (void)testUnboundViews {
+	// Establishes the cost of the views themselves, to subtract from the other
+	// results.
+	[RCLBenchmarkReport.sharedReport
+		measureBenchmarkNamed:@"binding.none"
+		bindingCount:RCLBindingViewCount
+		updateCount:1
+		bindingBlock:^ id (NSUInteger index) {
+			return [[NSView alloc] initWithFrame:CGRectZero];
+		}
+		updateBlock:^(NSUInteger iteration) {}];
+}
+
+- (void)testThreeAttributes {
+	[self measureBindingNamed:@"3" useAlignment:NO bindingsBlock:^(RACSignal *containerRect, RACSignal *padding, RACSignal *siblingView) {
+		return @{
+			rcl_left: [containerRect.left plus:padding],
+			rcl_top: [containerRect.top plus:padding],
+			rcl_width: @100,
+		};
+	}];
+}
+
+- (void)testFourAttributes {
+	[self measureBindingNamed:@"4" useAlignment:NO bindingsBlock:^(RACSignal *containerRect, RACSignal *padding, RACSignal *siblingView) {
+		return @{
+			rcl_left: [containerRect.left plus:padding],
+			rcl_top: [containerRect.top plus:padding],
+			rcl_width: [containerRect.width minus:[padding multipliedBy:[RACSignal return:@2]]],
+			rcl_height: @44,
+		};
+	}];
+}
+
+- (void)testFiveAttributes {
+	[self measureBindingNamed:@"5" useAlignment:NO bindingsBlock:^(RACSignal *containerRect, RACSignal *padding, RACSignal *siblingView) {
+		return @{
+			rcl_rect: containerRect,
+			rcl_size: MEDBox(CGSizeMake(100, 44)),
+			rcl_centerX: containerRect.centerX,
+			rcl_top: [containerRect.top plus:padding],
+			rcl_trailing: [containerRect.trailing minus:padding],
+		};
+	}];
+}
+
+- (void)testSixAttributes {
+	[self measureBindingNamed:@"6" useAlignment:YES bindingsBlock:^(RACSignal *containerRect, RACSignal *padding, RACSignal *siblingView) {
+		return @{
+			rcl_rect: containerRect,
+			rcl_width: [containerRect.width minus:padding],
+			rcl_height: @44,
+			rcl_leading: [containerRect.leading plus:padding],
+			rcl_top: [containerRect.top plus:padding],
+			rcl_baseline: siblingView,
+		};
+	}];
+}
+
+@end
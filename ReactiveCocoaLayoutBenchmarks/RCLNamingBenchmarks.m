@@ -0,0 +1,103 @@
+//
+//  RCLNamingBenchmarks.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Archimedes/Archimedes.h>
+#import <ReactiveCocoa/ReactiveCocoa.h>
+#import <ReactiveCocoaLayout/ReactiveCocoaLayout.h>
+#import <XCTest/XCTest.h>
+
+// The number of operators applied to each chain.
+static const NSUInteger RCLChainLength = 20;
+
+// The number of chains constructed per measurement.
+static const NSUInteger RCLChainCount = 500;
+
+@interface RCLNamingBenchmarks : XCTestCase
+
+@end
+
+@implementation RCLNamingBenchmarks
+
+#pragma mark Lifecycle
+
+- (void)tearDown {
+	unsetenv("RAC_DEBUG_SIGNAL_NAMES");
+
+	[super tearDown];
+}
+
+#pragma mark Helpers
+
+// Builds a chain of geometry operators, similar to that used for a typical
+// binding.
+- (RACSignal *)chainFromRectSignal:(RACSignal *)rectSignal widthSignal:(RACSignal *)widthSignal {
+	RACSignal *signal = rectSignal;
+
+	for (NSUInteger i = 0; i < RCLChainLength; i++) {
+		switch (i % 4) {
+			case 0:
+				signal = [signal alignAttribute:NSLayoutAttributeLeft to:[widthSignal plus:[RACSignal return:@8]]];
+				break;
+
+			case 1:
+				signal = [signal insetWidth:widthSignal height:widthSignal];
+				break;
+
+			case 2:
+				signal = [signal sliceWithAmount:widthSignal fromEdge:NSLayoutAttributeTop];
+				break;
+
+			case 3:
+				signal = [signal floor];
+				break;
+		}
+	}
+
+	return signal;
+}
+
+// Measures the construction of RCLChainCount chains.
+//
+// readNames - Whether to read the name of every chain after constructing it,
+//             forcing any lazy names to be formatted.
+- (void)measureChainConstructionReadingNames:(BOOL)readNames {
+	RACSignal *rectSignal = [RACSignal return:[NSValue med_valueWithRect:CGRectMake(0, 0, 100, 100)]];
+	RACSignal *widthSignal = [RACSignal return:@10];
+
+	[self measureBlock:^{
+		NSUInteger nameLength = 0;
+
+		for (NSUInteger i = 0; i < RCLChainCount; i++) {
+			@autoreleasepool {
+				RACSignal *signal = [self chainFromRectSignal:rectSignal widthSignal:widthSignal];
+				if (readNames) nameLength += signal.name.length;
+			}
+		}
+
+		XCTAssertTrue(readNames == (nameLength > 0));
+	}];
+}
+
+#pragma mark Benchmarks
+
+- (void)testChainConstructionWithoutNames {
+	unsetenv("RAC_DEBUG_SIGNAL_NAMES");
+	[self measureChainConstructionReadingNames:NO];
+}
+
+- (void)testChainConstructionWithLazyNames {
+	setenv("RAC_DEBUG_SIGNAL_NAMES", "1", 1);
+	[self measureChainConstructionReadingNames:NO];
+}
+
+- (void)testChainConstructionWithNamesRead {
+	setenv("RAC_DEBUG_SIGNAL_NAMES", "1", 1);
+	[self measureChainConstructionReadingNames:YES];
+}
+
+@end
@@ -0,0 +1,170 @@
+//
+//  RCLOperatorBenchmarks.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "RCLBenchmarkReport.h"
+#import <Archimedes/Archimedes.h>
+#import <ReactiveCocoa/ReactiveCocoa.h>
+#import <ReactiveCocoaLayout/ReactiveCocoaLayout.h>
+#import <XCTest/XCTest.h>
+
+// The number of bindings constructed for each operator.
+static const NSUInteger RCLOperatorBindingCount = 1000;
+
+// The number of updates sent to each binding.
+static const NSUInteger RCLOperatorUpdateCount = 100;
+
+// Applies an operator to signals of rects and numbers.
+typedef RACSignal * (^RCLOperatorBlock)(RACSignal *rects, RACSignal *numbers);
+
+@interface RCLOperatorBenchmarks : XCTestCase
+
+@end
+
+@implementation RCLOperatorBenchmarks
+
+#pragma mark Lifecycle
+
++ (void)tearDown {
+	NSError *error = nil;
+	if (![RCLBenchmarkReport.sharedReport writeIfRequested:&error]) {
+		NSLog(@"Could not write benchmark report: %@", error);
+	}
+
+	[super tearDown];
+}
+
+#pragma mark Helpers
+
+// Measures RCLOperatorBindingCount applications of an operator, each
+// subscribed to, while sending RCLOperatorUpdateCount new rects and numbers.
+- (void)measureOperatorNamed:(NSString *)name block:(RCLOperatorBlock)block {
+	RACSubject *rects = [RACReplaySubject replaySubjectWithCapacity:1];
+	RACSubject *numbers = [RACReplaySubject replaySubjectWithCapacity:1];
+
+	[rects sendNext:[NSValue med_valueWithRect:CGRectMake(0, 0, 100, 100)]];
+	[numbers sendNext:@10];
+
+	__block NSUInteger valueCount = 0;
+
+	RCLBenchmarkResult *result = [RCLBenchmarkReport.sharedReport
+		measureBenchmarkNamed:[@"operator." stringByAppendingString:name]
+		bindingCount:RCLOperatorBindingCount
+		updateCount:RCLOperatorUpdateCount
+		bindingBlock:^ id (NSUInteger index) {
+			return [block(rects, numbers) subscribeNext:^(id _) {
+				valueCount++;
+			}];
+		}
+		updateBlock:^(NSUInteger iteration) {
+			RCLPerformLayoutTransaction(^{
+				[rects sendNext:[NSValue med_valueWithRect:CGRectMake(iteration, iteration, 100 + iteration, 100 + iteration)]];
+				[numbers sendNext:@(10 + iteration)];
+			});
+		}];
+
+	XCTAssertTrue(valueCount >= RCLOperatorBindingCount, @"Expected every binding for %@ to send a value", name);
+	NSLog(@"%@", result);
+}
+
+#pragma mark Benchmarks
+
+- (void)testAttributeOperators {
+	[self measureOperatorNamed:@"left" block:^(RACSignal *rects, RACSignal *numbers) {
+		return rects.left;
+	}];
+
+	[self measureOperatorNamed:@"width" block:^(RACSignal *rects, RACSignal *numbers) {
+		return rects.width;
+	}];
+
+	[self measureOperatorNamed:@"size" block:^(RACSignal *rects, RACSignal *numbers) {
+		return rects.size;
+	}];
+
+	[self measureOperatorNamed:@"center" block:^(RACSignal *rects, RACSignal *numbers) {
+		return rects.center;
+	}];
+}
+
+- (void)testAlignmentOperators {
+	[self measureOperatorNamed:@"alignLeft" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects alignLeft:numbers];
+	}];
+
+	[self measureOperatorNamed:@"alignRight" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects alignRight:numbers];
+	}];
+
+	[self measureOperatorNamed:@"alignWidth" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects alignWidth:numbers];
+	}];
+
+	[self measureOperatorNamed:@"alignCenterX" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects alignCenterX:numbers];
+	}];
+
+	[self measureOperatorNamed:@"alignBaseline" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects alignBaseline:numbers toBaseline:numbers ofRect:rects];
+	}];
+}
+
+- (void)testRectOperators {
+	[self measureOperatorNamed:@"insetWidth" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects insetWidth:numbers height:numbers nullRect:CGRectZero];
+	}];
+
+	[self measureOperatorNamed:@"moveRight" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects moveRight:numbers];
+	}];
+
+	[self measureOperatorNamed:@"extendAttribute" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects extendAttribute:NSLayoutAttributeLeft byAmount:numbers];
+	}];
+
+	[self measureOperatorNamed:@"sliceWithAmount" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects sliceWithAmount:numbers fromEdge:NSLayoutAttributeTop];
+	}];
+
+	[self measureOperatorNamed:@"remainderAfterSlicingAmount" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [rects remainderAfterSlicingAmount:numbers fromEdge:NSLayoutAttributeTop];
+	}];
+
+	[self measureOperatorNamed:@"floor" block:^(RACSignal *rects, RACSignal *numbers) {
+		return rects.floor;
+	}];
+}
+
+- (void)testArithmeticOperators {
+	[self measureOperatorNamed:@"plus" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [numbers plus:rects.width];
+	}];
+
+	[self measureOperatorNamed:@"multipliedBy" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [numbers multipliedBy:rects.height];
+	}];
+
+	[self measureOperatorNamed:@"max" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [RACSignal max:@[ numbers, rects.width, rects.height ]];
+	}];
+
+	[self measureOperatorNamed:@"add" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [RACSignal add:@[ numbers, rects.width, rects.height ]];
+	}];
+}
+
+- (void)testCompositeChain {
+	[self measureOperatorNamed:@"chain" block:^(RACSignal *rects, RACSignal *numbers) {
+		return [[[[rects
+			insetWidth:numbers height:numbers nullRect:CGRectZero]
+			alignLeft:[numbers plus:[RACSignal return:@8]]]
+			sliceWithAmount:numbers fromEdge:NSLayoutAttributeTop]
+			floor];
+	}];
+}
+
+@end
@@ -60,4 +60,158 @@ describe(@"NSTextField", ^{
 	});
 });
 
+describe(@"backing alignment", ^{
+	__block NSWindow *window;
+	__block NSView *container;
+	__block NSView *view;
+
+	// Aligns the given rect the way -setRcl_frame: did before transforms were
+	// cached.
+	CGRect (^expectedFrame)(CGRect) = ^(CGRect frame) {
+		NSAlignmentOptions options = NSAlignMinXOutward | NSAlignMinYInward | NSAlignWidthInward | NSAlignHeightInward;
+
+		CGRect windowFrame = [container convertRect:frame toView:nil];
+		CGRect alignedWindowFrame = [container backingAlignedRect:windowFrame options:options];
+		return [container convertRect:alignedWindowFrame fromView:nil];
+	};
+
+	beforeEach(^{
+		window = [[NSWindow alloc] initWithContentRect:CGRectMake(0, 0, 500, 500) styleMask:NSBorderlessWindowMask backing:NSBackingStoreBuffered defer:YES];
+		window.releasedWhenClosed = NO;
+
+		container = [[NSView alloc] initWithFrame:CGRectMake(10.25, 20.75, 300, 300)];
+		[window.contentView addSubview:container];
+
+		view = [[NSView alloc] initWithFrame:CGRectZero];
+		[container addSubview:view];
+	});
+
+	afterEach(^{
+		[window close];
+	});
+
+	it(@"should align frames like -backingAlignedRect:options:", ^{
+		CGRect frame = CGRectMake(3.3, 4.6, 50.7, 60.2);
+		view.rcl_frame = frame;
+		expect(MEDBox(view.frame)).to(equal(MEDBox(expectedFrame(frame))));
+
+		frame = CGRectMake(-7.9, 100.1, 0.4, 12.5);
+		view.rcl_frame = frame;
+		expect(MEDBox(view.frame)).to(equal(MEDBox(expectedFrame(frame))));
+	});
+
+	it(@"should not assign a frame which aligns to the current one", ^{
+		view.rcl_frame = CGRectMake(3.3, 4.6, 50.7, 60.2);
+
+		__block NSUInteger changeCount = 0;
+		view.postsFrameChangedNotifications = YES;
+		id observer = [NSNotificationCenter.defaultCenter addObserverForName:NSViewFrameDidChangeNotification object:view queue:nil usingBlock:^(NSNotification *notification) {
+			changeCount++;
+		}];
+
+		view.rcl_frame = CGRectMake(3.31, 4.59, 50.71, 60.19);
+		expect(@(changeCount)).to(equal(@0));
+
+		view.rcl_frame = CGRectMake(13.3, 4.6, 50.7, 60.2);
+		expect(@(changeCount)).to(equal(@1));
+
+		[NSNotificationCenter.defaultCenter removeObserver:observer];
+	});
+
+	it(@"should align frames within a scaled superview", ^{
+		[container scaleUnitSquareToSize:NSMakeSize(2, 0.5)];
+
+		CGRect frame = CGRectMake(3.3, 4.6, 50.7, 60.2);
+		view.rcl_frame = frame;
+		expect(MEDBox(view.frame)).to(equal(MEDBox(expectedFrame(frame))));
+	});
+
+	it(@"should align frames after the superview moves", ^{
+		CGRect frame = CGRectMake(3.3, 4.6, 50.7, 60.2);
+		view.rcl_frame = frame;
+
+		container.frame = CGRectMake(0.5, 0.5, 300, 300);
+		view.rcl_frame = frame;
+		expect(MEDBox(view.frame)).to(equal(MEDBox(expectedFrame(frame))));
+	});
+
+	it(@"should align frames after an ancestor moves", ^{
+		NSView *innerContainer = [[NSView alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+		[container addSubview:innerContainer];
+		[view removeFromSuperview];
+		[innerContainer addSubview:view];
+
+		CGRect frame = CGRectMake(3.3, 4.6, 50.7, 60.2);
+		view.rcl_frame = frame;
+
+		container.frame = CGRectMake(0.5, 0.25, 300, 300);
+		view.rcl_frame = frame;
+
+		NSAlignmentOptions options = NSAlignMinXOutward | NSAlignMinYInward | NSAlignWidthInward | NSAlignHeightInward;
+		CGRect windowFrame = [innerContainer convertRect:frame toView:nil];
+		CGRect expected = [innerContainer convertRect:[innerContainer backingAlignedRect:windowFrame options:options] fromView:nil];
+		expect(MEDBox(view.frame)).to(equal(MEDBox(expected)));
+	});
+
+	describe(@"within an intermediate ancestor", ^{
+		__block NSView *innerContainer;
+
+		// Aligns the given rect within `innerContainer`, the way
+		// -setRcl_frame: did before transforms were cached.
+		CGRect (^expectedInnerFrame)(CGRect) = ^(CGRect frame) {
+			NSAlignmentOptions options = NSAlignMinXOutward | NSAlignMinYInward | NSAlignWidthInward | NSAlignHeightInward;
+
+			CGRect windowFrame = [innerContainer convertRect:frame toView:nil];
+			return [innerContainer convertRect:[innerContainer backingAlignedRect:windowFrame options:options] fromView:nil];
+		};
+
+		beforeEach(^{
+			innerContainer = [[NSView alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+			[container addSubview:innerContainer];
+
+			[view removeFromSuperview];
+			[innerContainer addSubview:view];
+		});
+
+		it(@"should align frames after the ancestor is reparented", ^{
+			CGRect frame = CGRectMake(3.3, 4.6, 50.7, 60.2);
+			view.rcl_frame = frame;
+
+			// Same frame, but a different position within the window.
+			[innerContainer removeFromSuperview];
+			[window.contentView addSubview:innerContainer];
+
+			view.rcl_frame = frame;
+			expect(MEDBox(view.frame)).to(equal(MEDBox(expectedInnerFrame(frame))));
+		});
+
+		it(@"should align frames after an ancestor which posts no notifications moves", ^{
+			container.postsFrameChangedNotifications = NO;
+			container.postsBoundsChangedNotifications = NO;
+
+			CGRect frame = CGRectMake(3.3, 4.6, 50.7, 60.2);
+			view.rcl_frame = frame;
+
+			container.frame = CGRectMake(0.5, 0.25, 300, 300);
+			view.rcl_frame = frame;
+			expect(MEDBox(view.frame)).to(equal(MEDBox(expectedInnerFrame(frame))));
+		});
+	});
+
+	it(@"should align bounds", ^{
+		view.frame = CGRectMake(0.5, 0.5, 100, 100);
+
+		CGRect bounds = CGRectMake(1.3, 2.6, 50.7, 60.2);
+
+		// Computed first, because changing the bounds changes the coordinate
+		// system they're aligned in.
+		NSAlignmentOptions options = NSAlignMinXOutward | NSAlignMinYInward | NSAlignWidthInward | NSAlignHeightInward;
+		CGRect windowRect = [view convertRect:bounds toView:nil];
+		CGRect expected = [view convertRect:[view backingAlignedRect:windowRect options:options] fromView:nil];
+
+		view.rcl_bounds = bounds;
+		expect(MEDBox(view.bounds)).to(equal(MEDBox(expected)));
+	});
+});
+
 QuickSpecEnd
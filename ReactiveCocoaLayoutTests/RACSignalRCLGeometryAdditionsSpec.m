@@ -443,6 +443,37 @@ describe(@"signal of CGRects", ^{
 		[subject sendNext:@0];
 		[subject sendNext:@5];
 
+		NSArray *expected = @[
+			MEDBox(CGRectMake(0, 0, 0, 0)),
+			MEDBox(CGRectMake(5, 5, 5, 5)),
+		];
+
+		expect(values).to(equal(expected));
+	});
+
+	it(@"should send a value for each change to distinct signals from +rectsWithX:Y:width:height:", ^{
+		RACSubject *xSubject = [RACSubject subject];
+		RACSubject *ySubject = [RACSubject subject];
+		RACSubject *widthSubject = [RACSubject subject];
+		RACSubject *heightSubject = [RACSubject subject];
+
+		RACSignal *constructedSignal = [RACSignal rectsWithX:xSubject Y:ySubject width:widthSubject height:heightSubject];
+		NSMutableArray *values = [NSMutableArray array];
+
+		[constructedSignal subscribeNext:^(id value) {
+			[values addObject:value];
+		}];
+
+		[xSubject sendNext:@0];
+		[ySubject sendNext:@0];
+		[widthSubject sendNext:@0];
+		[heightSubject sendNext:@0];
+
+		[xSubject sendNext:@5];
+		[ySubject sendNext:@5];
+		[widthSubject sendNext:@5];
+		[heightSubject sendNext:@5];
+
 		NSArray *expected = @[
 			MEDBox(CGRectMake(0, 0, 0, 0)),
 			MEDBox(CGRectMake(5, 0, 0, 0)),
@@ -799,6 +830,30 @@ describe(@"signal of CGSizes", ^{
 		[subject sendNext:@0];
 		[subject sendNext:@5];
 
+		NSArray *expected = @[
+			MEDBox(CGSizeMake(0, 0)),
+			MEDBox(CGSizeMake(5, 5)),
+		];
+
+		expect(values).to(equal(expected));
+	});
+
+	it(@"should send a value for each change to distinct signals from +sizesWithWidth:height:", ^{
+		RACSubject *widthSubject = [RACSubject subject];
+		RACSubject *heightSubject = [RACSubject subject];
+
+		RACSignal *constructedSignal = [RACSignal sizesWithWidth:widthSubject height:heightSubject];
+		NSMutableArray *values = [NSMutableArray array];
+
+		[constructedSignal subscribeNext:^(id value) {
+			[values addObject:value];
+		}];
+
+		[widthSubject sendNext:@0];
+		[heightSubject sendNext:@0];
+		[widthSubject sendNext:@5];
+		[heightSubject sendNext:@5];
+
 		NSArray *expected = @[
 			MEDBox(CGSizeMake(0, 0)),
 			MEDBox(CGSizeMake(5, 0)),
@@ -875,6 +930,30 @@ describe(@"signal of CGPoints", ^{
 		[subject sendNext:@0];
 		[subject sendNext:@5];
 
+		NSArray *expected = @[
+			MEDBox(CGPointMake(0, 0)),
+			MEDBox(CGPointMake(5, 5)),
+		];
+
+		expect(values).to(equal(expected));
+	});
+
+	it(@"should send a value for each change to distinct signals from +pointsWithX:Y:", ^{
+		RACSubject *xSubject = [RACSubject subject];
+		RACSubject *ySubject = [RACSubject subject];
+
+		RACSignal *constructedSignal = [RACSignal pointsWithX:xSubject Y:ySubject];
+		NSMutableArray *values = [NSMutableArray array];
+
+		[constructedSignal subscribeNext:^(id value) {
+			[values addObject:value];
+		}];
+
+		[xSubject sendNext:@0];
+		[ySubject sendNext:@0];
+		[xSubject sendNext:@5];
+		[ySubject sendNext:@5];
+
 		NSArray *expected = @[
 			MEDBox(CGPointMake(0, 0)),
 			MEDBox(CGPointMake(5, 0)),
@@ -1011,6 +1090,111 @@ it(@"should return maximums and minimums", ^{
 	expect(receivedMaximums).to(equal(maximums));
 });
 
+describe(@"reductions over many signals", ^{
+	__block NSArray *subjects;
+
+	beforeEach(^{
+		NSMutableArray *mutableSubjects = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 20; i++) {
+			[mutableSubjects addObject:[RACSubject subject]];
+		}
+
+		subjects = mutableSubjects;
+	});
+
+	void (^sendInitialValues)(void) = ^{
+		[subjects enumerateObjectsUsingBlock:^(RACSubject *subject, NSUInteger index, BOOL *stop) {
+			[subject sendNext:@(index + 1)];
+		}];
+	};
+
+	it(@"should update maximums and minimums", ^{
+		NSMutableArray *receivedMaximums = [NSMutableArray array];
+		[[RACSignal max:subjects] subscribeNext:^(NSNumber *n) {
+			[receivedMaximums addObject:n];
+		}];
+
+		NSMutableArray *receivedMinimums = [NSMutableArray array];
+		[[RACSignal min:subjects] subscribeNext:^(NSNumber *n) {
+			[receivedMinimums addObject:n];
+		}];
+
+		sendInitialValues();
+		expect(receivedMaximums).to(equal(@[ @20 ]));
+		expect(receivedMinimums).to(equal(@[ @1 ]));
+
+		[subjects[19] sendNext:@5];
+		expect(receivedMaximums).to(equal(@[ @20, @19 ]));
+
+		[subjects[10] sendNext:@-3];
+		expect(receivedMinimums).to(equal(@[ @1, @-3 ]));
+
+		[subjects[10] sendNext:@7];
+		expect(receivedMinimums).to(equal(@[ @1, @-3, @1 ]));
+
+		// Unchanged results should not be sent again.
+		[subjects[5] sendNext:@8];
+		expect(receivedMaximums).to(equal(@[ @20, @19 ]));
+		expect(receivedMinimums).to(equal(@[ @1, @-3, @1 ]));
+	});
+
+	it(@"should skip NSNull when finding maximums", ^{
+		NSMutableArray *receivedMaximums = [NSMutableArray array];
+		[[RACSignal max:subjects] subscribeNext:^(NSNumber *n) {
+			[receivedMaximums addObject:n];
+		}];
+
+		[subjects enumerateObjectsUsingBlock:^(RACSubject *subject, NSUInteger index, BOOL *stop) {
+			[subject sendNext:NSNull.null];
+		}];
+
+		expect(receivedMaximums).to(equal(@[]));
+
+		[subjects[3] sendNext:@10];
+		expect(receivedMaximums).to(equal(@[ @10 ]));
+
+		[subjects[7] sendNext:@12];
+		expect(receivedMaximums).to(equal(@[ @10, @12 ]));
+
+		[subjects[7] sendNext:NSNull.null];
+		expect(receivedMaximums).to(equal(@[ @10, @12, @10 ]));
+	});
+
+	it(@"should update sums and differences", ^{
+		NSMutableArray *receivedSums = [NSMutableArray array];
+		[[RACSignal add:subjects] subscribeNext:^(NSNumber *n) {
+			[receivedSums addObject:n];
+		}];
+
+		NSMutableArray *receivedDifferences = [NSMutableArray array];
+		[[RACSignal subtract:subjects] subscribeNext:^(NSNumber *n) {
+			[receivedDifferences addObject:n];
+		}];
+
+		sendInitialValues();
+		expect(receivedSums.lastObject).to(equal(@210));
+		expect(receivedDifferences.lastObject).to(equal(@-208));
+
+		[subjects[0] sendNext:@11];
+		expect(receivedSums.lastObject).to(equal(@220));
+		expect(receivedDifferences.lastObject).to(equal(@-198));
+
+		[subjects[19] sendNext:@0];
+		expect(receivedSums.lastObject).to(equal(@200));
+		expect(receivedDifferences.lastObject).to(equal(@-178));
+	});
+
+	it(@"should add points", ^{
+		NSMutableArray *points = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 10; i++) {
+			[points addObject:[RACSignal return:MEDBox(CGPointMake(i, 1))]];
+		}
+
+		CGPoint expected = CGPointMake(45, 10);
+		expect([RACSignal add:points].sequence).to(equal(@[ MEDBox(expected) ].rac_sequence));
+	});
+});
+
 describe(@"mathematical operators", ^{
 	__block RACSignal *numberA;
 	__block RACSignal *numberB;
@@ -1290,6 +1474,89 @@ describe(@"-ceil", ^{
 	});
 });
 
+describe(@"-distinctGeometry", ^{
+	__block RACSubject *subject;
+
+	beforeEach(^{
+		subject = [RACSubject subject];
+	});
+
+	it(@"should skip repeated values", ^{
+		NSMutableArray *values = [NSMutableArray array];
+		[subject.distinctGeometry subscribeNext:^(id value) {
+			[values addObject:value];
+		}];
+
+		[subject sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[subject sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[subject sendNext:MEDBox(CGRectMake(1, 2, 3, 5))];
+		[subject sendNext:@5];
+		[subject sendNext:@5];
+
+		NSArray *expected = @[ MEDBox(CGRectMake(1, 2, 3, 4)), MEDBox(CGRectMake(1, 2, 3, 5)), @5 ];
+		expect(values).to(equal(expected));
+	});
+
+	it(@"should skip values within the tolerance of the last value sent", ^{
+		NSMutableArray *values = [NSMutableArray array];
+		[[subject distinctGeometryWithTolerance:0.5] subscribeNext:^(id value) {
+			[values addObject:value];
+		}];
+
+		[subject sendNext:MEDBox(CGSizeMake(10, 10))];
+		[subject sendNext:MEDBox(CGSizeMake(10.25, 9.75))];
+		[subject sendNext:MEDBox(CGSizeMake(10.5, 10))];
+		[subject sendNext:MEDBox(CGSizeMake(10.75, 10))];
+
+		NSArray *expected = @[ MEDBox(CGSizeMake(10, 10)), MEDBox(CGSizeMake(10.75, 10)) ];
+		expect(values).to(equal(expected));
+	});
+
+	it(@"should not box skipped values", ^{
+		RACSignal *signal = [subject.size.width distinctGeometry];
+		expect(@(signal.rcl_stageCount)).to(equal(@1));
+
+		[signal subscribeNext:^(id _) {}];
+
+		RCLProfiler *profiler = RCLProfiler.sharedProfiler;
+		[profiler reset];
+		profiler.enabled = YES;
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 20, 20))];
+		[subject sendNext:MEDBox(CGRectMake(5, 5, 20, 30))];
+		[subject sendNext:MEDBox(CGRectMake(5, 0, 20, 40))];
+		expect(@(profiler.boxedValueCount)).to(equal(@1));
+
+		profiler.enabled = NO;
+		[profiler reset];
+	});
+
+	it(@"should track the last value for each subscriber", ^{
+		RACSignal *signal = subject.distinctGeometry;
+
+		__block NSUInteger firstCount = 0;
+		[signal subscribeNext:^(id _) {
+			firstCount++;
+		}];
+
+		[subject sendNext:@1];
+
+		__block NSUInteger secondCount = 0;
+		[signal subscribeNext:^(id _) {
+			secondCount++;
+		}];
+
+		[subject sendNext:@1];
+		expect(@(firstCount)).to(equal(@1));
+		expect(@(secondCount)).to(equal(@1));
+	});
+
+	it(@"should send constants unchanged", ^{
+		RACSignal *constant = [RACSignal constant:@5];
+		expect(@(constant.distinctGeometry == constant)).to(beTruthy());
+	});
+});
+
 describe(@"-offsetByAmount:towardEdge:", ^{
 	__block RACSignal *rectSignal;
 	__block RACSignal *pointSignal;
@@ -1406,4 +1673,535 @@ describe(@"-offsetByAmount:towardEdge:", ^{
 	});
 });
 
+describe(@"-divideWithAmount:padding:fromEdge:", ^{
+	__block RACSubject *subject;
+	__block NSUInteger subscriptionCount;
+	__block NSUInteger disposalCount;
+	__block RACSignal *rects;
+
+	beforeEach(^{
+		subject = [RACSubject subject];
+		subscriptionCount = 0;
+		disposalCount = 0;
+
+		rects = [RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+			subscriptionCount++;
+
+			RACDisposable *disposable = [subject subscribe:subscriber];
+			return [RACDisposable disposableWithBlock:^{
+				disposalCount++;
+				[disposable dispose];
+			}];
+		}];
+	});
+
+	it(@"should subscribe to its inputs once for both rects", ^{
+		RACTupleUnpack(RACSignal *slices, RACSignal *remainders) = [rects divideWithAmount:[RACSignal return:@10] padding:[RACSignal return:@2] fromEdge:NSLayoutAttributeLeft];
+
+		NSMutableArray *values = [NSMutableArray array];
+		[slices subscribeNext:^(id value) {
+			[values addObject:value];
+		}];
+
+		[remainders subscribeNext:^(id value) {
+			[values addObject:value];
+		}];
+
+		[[RACSignal rectsWithOrigin:slices.origin size:remainders.size] subscribeNext:^(id value) {
+			[values addObject:value];
+		}];
+
+		expect(@(subscriptionCount)).to(equal(@1));
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 30, 20))];
+
+		NSArray *expected = @[
+			MEDBox(CGRectMake(0, 0, 10, 20)),
+			MEDBox(CGRectMake(12, 0, 18, 20)),
+			MEDBox(CGRectMake(0, 0, 18, 20)),
+		];
+
+		expect(values).to(equal(expected));
+	});
+
+	it(@"should send the latest rect to new subscribers", ^{
+		RACTupleUnpack(RACSignal *slices, RACSignal *remainders) = [rects divideWithAmount:[RACSignal return:@10] padding:RACSignal.zero fromEdge:NSLayoutAttributeLeft];
+
+		[slices subscribeNext:^(id _) {}];
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 30, 20))];
+
+		__block NSValue *lastRemainder = nil;
+		[remainders subscribeNext:^(NSValue *value) {
+			lastRemainder = value;
+		}];
+
+		expect(lastRemainder).to(equal(MEDBox(CGRectMake(10, 0, 20, 20))));
+		expect(@(subscriptionCount)).to(equal(@1));
+	});
+
+	it(@"should resubscribe to its inputs after all subscriptions are disposed", ^{
+		RACTupleUnpack(RACSignal *slices, RACSignal *remainders) = [rects divideWithAmount:[RACSignal return:@10] padding:RACSignal.zero fromEdge:NSLayoutAttributeLeft];
+
+		RACDisposable *sliceDisposable = [slices subscribeNext:^(id _) {}];
+		RACDisposable *remainderDisposable = [remainders subscribeNext:^(id _) {}];
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 30, 20))];
+
+		[sliceDisposable dispose];
+		expect(@(disposalCount)).to(equal(@0));
+
+		[remainderDisposable dispose];
+		expect(@(disposalCount)).to(equal(@1));
+
+		// A stale rect should not be replayed after reconnecting.
+		__block NSValue *lastSlice = nil;
+		[slices subscribeNext:^(NSValue *value) {
+			lastSlice = value;
+		}];
+
+		expect(lastSlice).to(beNil());
+		expect(@(subscriptionCount)).to(equal(@2));
+
+		[subject sendNext:MEDBox(CGRectMake(5, 0, 30, 20))];
+		expect(lastSlice).to(equal(MEDBox(CGRectMake(5, 0, 10, 20))));
+	});
+
+	it(@"should not replay a stale rect to subscribers while sending a newer one", ^{
+		RACTupleUnpack(RACSignal *slices, RACSignal *remainders) = [rects divideWithAmount:[RACSignal return:@10] padding:RACSignal.zero fromEdge:NSLayoutAttributeLeft];
+
+		// Stay connected for the whole test.
+		[remainders subscribeNext:^(id _) {}];
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 30, 20))];
+
+		// Send rects which move further right each time.
+		dispatch_group_t group = dispatch_group_create();
+		dispatch_group_async(group, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+			for (NSUInteger i = 1; i <= 5000; i++) {
+				[subject sendNext:MEDBox(CGRectMake(i, 0, 30, 20))];
+			}
+		});
+
+		NSMutableArray *receivedPositions = [NSMutableArray array];
+
+		while (dispatch_group_wait(group, DISPATCH_TIME_NOW) != 0) {
+			NSMutableArray *positions = [NSMutableArray array];
+			[receivedPositions addObject:positions];
+
+			RACDisposable *disposable = [slices subscribeNext:^(NSValue *value) {
+				@synchronized (positions) {
+					[positions addObject:@(value.med_rectValue.origin.x)];
+				}
+			}];
+
+			[disposable dispose];
+		}
+
+		for (NSMutableArray *positions in receivedPositions) {
+			@synchronized (positions) {
+				NSArray *sorted = [positions sortedArrayUsingSelector:@selector(compare:)];
+				expect(positions).to(equal(sorted));
+			}
+		}
+	});
+});
+
+describe(@"-divideWithAmounts:padding:fromEdge:mode:", ^{
+	__block RACSubject *subject;
+	__block NSArray *amounts;
+
+	// Subscribes to each signal, and returns the latest value of each.
+	NSArray * (^latestValues)(NSArray *) = ^(NSArray *signals) {
+		NSMutableArray *values = [NSMutableArray array];
+
+		[signals enumerateObjectsUsingBlock:^(RACSignal *signal, NSUInteger index, BOOL *stop) {
+			[values addObject:NSNull.null];
+			[signal subscribeNext:^(id value) {
+				values[index] = value;
+			}];
+		}];
+
+		return values;
+	};
+
+	beforeEach(^{
+		subject = [RACSubject subject];
+		amounts = @[ [RACSignal return:@10], [RACSignal return:@20], [RACSignal return:@30] ];
+	});
+
+	it(@"should divide like chained calls to -divideWithAmount:padding:fromEdge:", ^{
+		NSArray *values = latestValues([subject divideWithAmounts:amounts padding:[RACSignal return:@5] fromEdge:NSLayoutAttributeRight mode:RCLDivisionModeFixed]);
+
+		RACTupleUnpack(RACSignal *first, RACSignal *firstRemainder) = [subject divideWithAmount:amounts[0] padding:[RACSignal return:@5] fromEdge:NSLayoutAttributeRight];
+		RACTupleUnpack(RACSignal *second, RACSignal *secondRemainder) = [firstRemainder divideWithAmount:amounts[1] padding:[RACSignal return:@5] fromEdge:NSLayoutAttributeRight];
+		RACSignal *third = [secondRemainder sliceWithAmount:amounts[2] fromEdge:NSLayoutAttributeRight];
+		NSArray *chainedValues = latestValues(@[ first, second, third ]);
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 50, 10))];
+
+		expect(values).to(equal(chainedValues));
+		expect(values).to(equal((@[
+			MEDBox(CGRectMake(40, 0, 10, 10)),
+			MEDBox(CGRectMake(15, 0, 20, 10)),
+			MEDBox(CGRectMake(0, 0, 10, 10)),
+		])));
+	});
+
+	it(@"should share out the remaining length by weight", ^{
+		NSArray *values = latestValues([subject divideWithAmounts:amounts padding:[RACSignal return:@5] fromEdge:NSLayoutAttributeLeft mode:RCLDivisionModeProportional]);
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 130, 10))];
+
+		expect(values).to(equal((@[
+			MEDBox(CGRectMake(0, 0, 20, 10)),
+			MEDBox(CGRectMake(25, 0, 40, 10)),
+			MEDBox(CGRectMake(70, 0, 60, 10)),
+		])));
+	});
+
+	it(@"should fill the remaining length with an extra rect", ^{
+		NSArray *signals = [subject divideWithAmounts:amounts padding:RACSignal.zero fromEdge:NSLayoutAttributeLeft mode:RCLDivisionModeFill];
+		expect(@(signals.count)).to(equal(@4));
+
+		NSArray *values = latestValues(signals);
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 100, 10))];
+
+		expect(values.lastObject).to(equal(MEDBox(CGRectMake(60, 0, 40, 10))));
+	});
+
+	it(@"should subscribe to its inputs once for every rect", ^{
+		__block NSUInteger subscriptionCount = 0;
+		RACSignal *rects = [RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+			subscriptionCount++;
+			return [subject subscribe:subscriber];
+		}];
+
+		NSMutableArray *widths = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 40; i++) {
+			[widths addObject:[RACSignal return:@1]];
+		}
+
+		NSArray *values = latestValues([rects divideWithAmounts:widths padding:[RACSignal return:@1] fromEdge:NSLayoutAttributeLeft mode:RCLDivisionModeProportional]);
+		expect(@(subscriptionCount)).to(equal(@1));
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 79, 10))];
+		expect(values.lastObject).to(equal(MEDBox(CGRectMake(78, 0, 1, 10))));
+	});
+});
+
+describe(@"fusion", ^{
+	__block RACSubject *subject;
+
+	beforeEach(^{
+		subject = [RACSubject subject];
+	});
+
+	it(@"should fuse a chain of operators into one stage", ^{
+		RACSignal *signal = [[[[subject
+			insetWidth:[RACSignal return:@1] height:[RACSignal return:@1] nullRect:CGRectZero]
+			alignLeft:[RACSignal return:@5]]
+			sliceWithAmount:[RACSignal return:@10] fromEdge:NSLayoutAttributeLeft]
+			floor];
+
+		expect(@(signal.rcl_stageCount)).to(equal(@1));
+
+		__block NSValue *lastValue = nil;
+		[signal subscribeNext:^(NSValue *value) {
+			lastValue = value;
+		}];
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 20.5, 20.5))];
+		expect(lastValue).to(equal(MEDBox(CGRectMake(5, 1, 10, 18))));
+	});
+
+	it(@"should fuse operands created by other operators", ^{
+		RACSignal *signal = [RACSignal rectsWithOrigin:subject.origin size:[subject.size replaceWidth:subject.height]];
+		expect(@(signal.rcl_stageCount)).to(equal(@1));
+
+		__block NSValue *lastValue = nil;
+		[signal subscribeNext:^(NSValue *value) {
+			lastValue = value;
+		}];
+
+		[subject sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		expect(lastValue).to(equal(MEDBox(CGRectMake(1, 2, 4, 4))));
+	});
+
+	it(@"should count stages separated by other signals", ^{
+		RACSignal *signal = [[subject.size map:^(NSValue *value) {
+			return value;
+		}] width];
+
+		expect(@(signal.rcl_stageCount)).to(equal(@1));
+		expect(@(subject.rcl_stageCount)).to(equal(@0));
+	});
+
+	it(@"should complete when fused inputs complete", ^{
+		RACSignal *signal = [[subject alignLeading:[RACSignal return:@5]] leading];
+
+		__block BOOL completed = NO;
+		[signal subscribeCompleted:^{
+			completed = YES;
+		}];
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 10, 10))];
+		expect(@(completed)).to(beFalsy());
+
+		[subject sendCompleted];
+		expect(@(completed)).to(beTruthy());
+	});
+
+	it(@"should send the same values as unfused operators when an operation produces nothing", ^{
+		RACSubject *addendSubject = [RACSubject subject];
+
+		// Like the operation of +max:, but fusable, since it's not distinct.
+		RCLGeometrySignal *latestNumber = [RCLGeometrySignal signalWithOperands:@[ subject ] operation:^(const RCLGeometry *values) {
+			return (values[0].type == RCLGeometryTypeNumber ? values[0] : RCLGeometryNone);
+		}];
+
+		RACSignal *fusedSignal = [[[latestNumber negate] plus:addendSubject] distinctGeometry];
+		expect(@(fusedSignal.rcl_stageCount)).to(equal(@1));
+
+		// A distinct signal is never fused. None of the numbers below repeat,
+		// so it sends the same values as `latestNumber`.
+		RACSignal *unfusedSignal = [[[[latestNumber distinctWithTolerance:0] negate] plus:addendSubject] distinctGeometry];
+		expect(@(unfusedSignal.rcl_stageCount)).to(equal(@2));
+
+		NSMutableArray *fusedValues = [NSMutableArray array];
+		[fusedSignal subscribeNext:^(NSNumber *value) {
+			[fusedValues addObject:value];
+		}];
+
+		NSMutableArray *unfusedValues = [NSMutableArray array];
+		[unfusedSignal subscribeNext:^(NSNumber *value) {
+			[unfusedValues addObject:value];
+		}];
+
+		[subject sendNext:@1];
+		[addendSubject sendNext:@10];
+		[subject sendNext:NSNull.null];
+		[addendSubject sendNext:@20];
+		[subject sendNext:@2];
+
+		expect(fusedValues).to(equal(unfusedValues));
+		expect(fusedValues).to(equal(@[ @9, @19, @18 ]));
+	});
+});
+
+describe(@"constant folding", ^{
+	it(@"should send its value like +return:", ^{
+		expect([[RACSignal constant:@(ULLONG_MAX)] toArray]).to(equal(@[ @(ULLONG_MAX) ]));
+		expect([[RACSignal constant:MEDBox(CGSizeMake(1, 2))] toArray]).to(equal(@[ MEDBox(CGSizeMake(1, 2)) ]));
+	});
+
+	it(@"should send other values without folding them", ^{
+		RACSignal *signal = [RACSignal constant:@"foo"];
+		expect([signal toArray]).to(equal(@[ @"foo" ]));
+	});
+
+	it(@"should fold constant operands into an operator", ^{
+		RACSubject *subject = [RACSubject subject];
+		RACSignal *signal = [subject alignWidth:[[RACSignal constant:@4] multipliedBy:[RACSignal constant:@5]]];
+
+		expect(@(signal.rcl_stageCount)).to(equal(@1));
+
+		__block NSValue *lastValue = nil;
+		[signal subscribeNext:^(NSValue *value) {
+			lastValue = value;
+		}];
+
+		[subject sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		expect(lastValue).to(equal(MEDBox(CGRectMake(1, 2, 20, 4))));
+	});
+
+	it(@"should make operators over constants constant", ^{
+		RACSignal *signal = [[[RACSignal constant:@8] plus:[RACSignal constant:@2]] multipliedBy:RCLBox(3)];
+
+		expect(@(signal.rcl_stageCount)).to(equal(@0));
+		expect([signal toArray]).to(equal(@[ @30 ]));
+	});
+
+	it(@"should send the extreme of constants once", ^{
+		RACSignal *signal = [RACSignal max:@[ [RACSignal constant:@1], [RACSignal constant:@5], RACSignal.zero ]];
+		expect([signal toArray]).to(equal(@[ @5 ]));
+	});
+
+	it(@"should subscribe to constants which cannot be folded", ^{
+		NSMutableArray *signals = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 20; i++) {
+			[signals addObject:[RACSignal constant:@(i)]];
+		}
+
+		expect([[RACSignal add:signals] toArray]).to(equal(@[ @190 ]));
+	});
+});
+
+describe(@"boxing", ^{
+	it(@"should only box values leaving a chain of operators", ^{
+		RACSubject *subject = [RACSubject subject];
+
+		RACSignal *signal = [[[[[subject
+			insetWidth:[RACSignal return:@1] height:[RACSignal return:@2] nullRect:CGRectZero]
+			alignLeft:[RACSignal return:@5]]
+			replaceSize:[RACSignal return:MEDBox(CGSizeMake(10, 10))]]
+			center]
+			x];
+
+		__block NSNumber *lastValue = nil;
+		[signal subscribeNext:^(NSNumber *x) {
+			lastValue = x;
+		}];
+
+		RCLProfiler *profiler = RCLProfiler.sharedProfiler;
+		[profiler reset];
+		profiler.enabled = YES;
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 20, 20))];
+		expect(lastValue).to(equal(@10));
+		expect(@(profiler.boxedValueCount)).to(equal(@1));
+
+		[subject sendNext:MEDBox(CGRectMake(10, 0, 40, 40))];
+		expect(lastValue).to(equal(@10));
+		expect(@(profiler.boxedValueCount)).to(equal(@2));
+
+		profiler.enabled = NO;
+		[profiler reset];
+	});
+
+	it(@"should box values for each subscriber", ^{
+		RACSubject *subject = [RACSubject subject];
+		RACSignal *signal = subject.size.width;
+
+		[signal subscribeNext:^(id _) {}];
+		[signal subscribeNext:^(id _) {}];
+
+		RCLProfiler *profiler = RCLProfiler.sharedProfiler;
+		[profiler reset];
+		profiler.enabled = YES;
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 20, 20))];
+		expect(@(profiler.boxedValueCount)).to(equal(@2));
+
+		profiler.enabled = NO;
+		[profiler reset];
+	});
+});
+
+describe(@"glitch-free propagation", ^{
+	__block RACSubject *subject;
+
+	beforeEach(^{
+		subject = [RACSubject subject];
+	});
+
+	it(@"should only send one value when a shared input changes", ^{
+		RACSignal *signal = [RACSignal rectsWithOrigin:subject.origin size:[subject.size replaceWidth:subject.height]];
+		expect(@(signal.rcl_stageCount)).to(equal(@1));
+
+		NSMutableArray *values = [NSMutableArray array];
+		[signal subscribeNext:^(NSValue *value) {
+			[values addObject:value];
+		}];
+
+		[subject sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[subject sendNext:MEDBox(CGRectMake(5, 6, 7, 8))];
+
+		NSArray *expected = @[
+			MEDBox(CGRectMake(1, 2, 4, 4)),
+			MEDBox(CGRectMake(5, 6, 8, 8)),
+		];
+
+		expect(values).to(equal(expected));
+	});
+
+	it(@"should complete when a shared input completes", ^{
+		RACSignal *signal = [subject alignCenterX:subject.centerX];
+
+		__block BOOL completed = NO;
+		[signal subscribeCompleted:^{
+			completed = YES;
+		}];
+
+		[subject sendNext:MEDBox(CGRectMake(0, 0, 10, 10))];
+		expect(@(completed)).to(beFalsy());
+
+		[subject sendCompleted];
+		expect(@(completed)).to(beTruthy());
+	});
+});
+
+describe(@"RCLPerformLayoutTransaction", ^{
+	__block RACSubject *xSubject;
+	__block RACSubject *ySubject;
+	__block NSMutableArray *values;
+
+	beforeEach(^{
+		xSubject = [RACSubject subject];
+		ySubject = [RACSubject subject];
+		values = [NSMutableArray array];
+
+		[[RACSignal pointsWithX:xSubject Y:ySubject] subscribeNext:^(NSValue *value) {
+			[values addObject:value];
+		}];
+
+		[xSubject sendNext:@0];
+		[ySubject sendNext:@0];
+		[values removeAllObjects];
+	});
+
+	it(@"should send one value after the transaction", ^{
+		RCLPerformLayoutTransaction(^{
+			[xSubject sendNext:@5];
+			[ySubject sendNext:@10];
+
+			expect(values).to(equal(@[]));
+		});
+
+		expect(values).to(equal(@[ MEDBox(CGPointMake(5, 10)) ]));
+	});
+
+	it(@"should wait for the outermost transaction", ^{
+		RCLPerformLayoutTransaction(^{
+			RCLPerformLayoutTransaction(^{
+				[xSubject sendNext:@5];
+			});
+
+			expect(values).to(equal(@[]));
+
+			[ySubject sendNext:@10];
+		});
+
+		expect(values).to(equal(@[ MEDBox(CGPointMake(5, 10)) ]));
+	});
+
+	it(@"should evaluate signals updated by earlier evaluations in the same transaction", ^{
+		RACSignal *doubledSum = [[xSubject plus:ySubject] map:^(NSNumber *n) {
+			return @(n.doubleValue * 2);
+		}];
+
+		NSMutableArray *sums = [NSMutableArray array];
+		[[doubledSum plus:[RACSignal return:@1]] subscribeNext:^(NSNumber *n) {
+			[sums addObject:n];
+		}];
+
+		RCLPerformLayoutTransaction(^{
+			[xSubject sendNext:@1];
+			[ySubject sendNext:@2];
+		});
+
+		expect(sums).to(equal(@[ @7 ]));
+	});
+
+	it(@"should send deferred values before completing", ^{
+		NSMutableArray *events = [NSMutableArray array];
+
+		RCLPerformLayoutTransaction(^{
+			[[RACSignal pointsWithX:[RACSignal return:@1] Y:[RACSignal return:@2]] subscribeNext:^(NSValue *value) {
+				[events addObject:value];
+			} completed:^{
+				[events addObject:@"completed"];
+			}];
+		});
+
+		expect(events).to(equal(@[ MEDBox(CGPointMake(1, 2)), @"completed" ]));
+	});
+});
+
 QuickSpecEnd
@@ -38,4 +38,17 @@ it(@"should immediately send the current trailing edge", ^{
 	expect(edge).notTo(equal(@(CGRectMaxYEdge)));
 });
 
+it(@"should share one signal for each edge", ^{
+	expect(@(RACSignal.leadingEdgeSignal == RACSignal.leadingEdgeSignal)).to(beTruthy());
+	expect(@(RACSignal.trailingEdgeSignal == RACSignal.trailingEdgeSignal)).to(beTruthy());
+});
+
+it(@"should send opposite edges", ^{
+	NSNumber *leadingEdge = [RACSignal.leadingEdgeSignal first];
+	NSNumber *trailingEdge = [RACSignal.trailingEdgeSignal first];
+
+	NSSet *edges = [NSSet setWithObjects:@(leadingEdge.integerValue), @(trailingEdge.integerValue), nil];
+	expect(edges).to(equal([NSSet setWithObjects:@(CGRectMinXEdge), @(CGRectMaxXEdge), nil]));
+});
+
 QuickSpecEnd
@@ -0,0 +1,145 @@
+//
+//  RCLGeometryKernelsSpec.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Archimedes/Archimedes.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+#import <ReactiveCocoaLayout/ReactiveCocoaLayout.h>
+
+QuickSpecBegin(RCLGeometryKernelsSpec)
+
+// More than one iteration of the vectorized loops, plus a remainder.
+static const CGFloat numbers[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5 };
+static const size_t numberCount = sizeof(numbers) / sizeof(*numbers);
+
+describe(@"reductions", ^{
+	it(@"should sum numbers", ^{
+		expect(@(RCLKernelSum(numbers, numberCount))).to(equal(@36));
+		expect(@(RCLKernelSum(numbers, 3))).to(equal(@8));
+		expect(@(RCLKernelSum(numbers, 0))).to(equal(@0));
+	});
+
+	it(@"should find the minimum", ^{
+		expect(@(RCLKernelMinimum(numbers, numberCount))).to(equal(@1));
+		expect(@(RCLKernelMinimum(numbers + 4, 5))).to(equal(@2));
+		expect(@(RCLKernelMinimum(numbers, 0))).to(equal(@(INFINITY)));
+	});
+
+	it(@"should find the maximum", ^{
+		expect(@(RCLKernelMaximum(numbers, numberCount))).to(equal(@9));
+		expect(@(RCLKernelMaximum(numbers, 3))).to(equal(@4));
+		expect(@(RCLKernelMaximum(numbers, 0))).to(equal(@(-INFINITY)));
+	});
+});
+
+describe(@"RCLKernelUnionRects", ^{
+	it(@"should union rects", ^{
+		CGRect rects[] = { CGRectMake(0, 0, 10, 10), CGRectMake(20, 5, -5, 10) };
+		expect(MEDBox(RCLKernelUnionRects(rects, 2))).to(equal(MEDBox(CGRectMake(0, 0, 20, 15))));
+	});
+
+	it(@"should ignore null rects", ^{
+		CGRect rects[] = { CGRectNull, CGRectMake(5, 5, 10, 10) };
+		expect(MEDBox(RCLKernelUnionRects(rects, 2))).to(equal(MEDBox(CGRectMake(5, 5, 10, 10))));
+	});
+
+	it(@"should return a null rect without any rects", ^{
+		CGRect rects[] = { CGRectNull };
+		expect(@(CGRectIsNull(RCLKernelUnionRects(rects, 1)))).to(beTruthy());
+		expect(@(CGRectIsNull(RCLKernelUnionRects(rects, 0)))).to(beTruthy());
+	});
+});
+
+describe(@"RCLKernelInsetRects", ^{
+	it(@"should inset rects", ^{
+		CGRect rects[] = { CGRectMake(0, 0, 10, 10), CGRectMake(10, 10, 20, 5) };
+		RCLKernelInsetRects(rects, rects, 2, 1, 2, 3, 1, CGRectZero);
+
+		expect(MEDBox(rects[0])).to(equal(MEDBox(CGRectMake(1, 2, 6, 7))));
+		expect(MEDBox(rects[1])).to(equal(MEDBox(CGRectMake(11, 12, 16, 2))));
+	});
+
+	it(@"should use the null rect when the insets are too large", ^{
+		CGRect rect = CGRectMake(0, 0, 10, 10);
+		CGRect nullRect = CGRectMake(1, 1, 1, 1);
+
+		CGRect result;
+		RCLKernelInsetRects(&rect, &result, 1, 6, 0, 6, 0, nullRect);
+		expect(MEDBox(result)).to(equal(MEDBox(nullRect)));
+	});
+});
+
+describe(@"RCLKernelOffsetRects", ^{
+	it(@"should offset rects", ^{
+		CGRect rects[] = { CGRectMake(0, 0, 10, 10), CGRectMake(10, 10, 20, 5) };
+
+		CGRect results[2];
+		RCLKernelOffsetRects(rects, results, 2, 5, -5);
+
+		expect(MEDBox(results[0])).to(equal(MEDBox(CGRectMake(5, -5, 10, 10))));
+		expect(MEDBox(results[1])).to(equal(MEDBox(CGRectMake(15, 5, 20, 5))));
+	});
+});
+
+describe(@"RCLKernelReducer", ^{
+	__block RCLKernelReducer *reducer;
+
+	afterEach(^{
+		RCLKernelReducerFree(reducer);
+		reducer = NULL;
+	});
+
+	it(@"should maintain a sum", ^{
+		reducer = RCLKernelReducerCreate(RCLKernelReductionSum, numberCount, 1);
+
+		for (size_t i = 0; i < numberCount; i++) {
+			RCLKernelReducerSetValue(reducer, i, numbers + i);
+		}
+
+		CGFloat result = 0;
+		RCLKernelReducerGetResult(reducer, &result);
+		expect(@(result)).to(equal(@36));
+
+		CGFloat replacement = 10;
+		RCLKernelReducerSetValue(reducer, 5, &replacement);
+		RCLKernelReducerGetResult(reducer, &result);
+		expect(@(result)).to(equal(@37));
+	});
+
+	it(@"should maintain a maximum of each component", ^{
+		reducer = RCLKernelReducerCreate(RCLKernelReductionMaximum, 3, 2);
+
+		CGFloat first[] = { 1, 10 };
+		CGFloat second[] = { 5, 2 };
+		RCLKernelReducerSetValue(reducer, 0, first);
+		RCLKernelReducerSetValue(reducer, 2, second);
+
+		CGFloat result[2];
+		RCLKernelReducerGetResult(reducer, result);
+		expect(@(result[0])).to(equal(@5));
+		expect(@(result[1])).to(equal(@10));
+	});
+
+	it(@"should ignore removed values", ^{
+		reducer = RCLKernelReducerCreate(RCLKernelReductionMinimum, numberCount, 1);
+
+		for (size_t i = 0; i < numberCount; i++) {
+			RCLKernelReducerSetValue(reducer, i, numbers + i);
+		}
+
+		RCLKernelReducerRemoveValue(reducer, 1);
+		RCLKernelReducerRemoveValue(reducer, 3);
+		expect(@(RCLKernelReducerValueCount(reducer))).to(equal(@(numberCount - 2)));
+
+		CGFloat result = 0;
+		RCLKernelReducerGetResult(reducer, &result);
+		expect(@(result)).to(equal(@2));
+	});
+});
+
+QuickSpecEnd
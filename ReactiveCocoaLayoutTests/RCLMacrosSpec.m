@@ -701,6 +701,42 @@ describe(@"RCLFrame", ^{
 	});
 });
 
+describe(@"bindings with the same attributes", ^{
+	it(@"should lay out each view from its own signals", ^{
+		RACSubject *lefts = [RACSubject subject];
+		RACSubject *widths = [RACSubject subject];
+
+		NSMutableArray *views = [NSMutableArray array];
+		for (NSUInteger i = 0; i < 3; i++) {
+			TestView *view = [[TestView alloc] initWithFrame:CGRectZero];
+			[view invalidateAndSetIntrinsicContentSize:CGSizeMake(10, 10)];
+
+			RCLFrame(view) = @{
+				rcl_left: [lefts plus:[RACSignal return:@(i * 100)]],
+				rcl_width: widths,
+				rcl_top: @(i)
+			};
+
+			[views addObject:view];
+		}
+
+		[lefts sendNext:@5];
+		[widths sendNext:@20];
+
+		for (NSUInteger i = 0; i < views.count; i++) {
+			TestView *view = views[i];
+			CGRect expected = CGRectMake(5 + i * 100, i, 20, 10);
+
+			#ifndef RCL_FOR_IPHONE
+				// On OS X, the top of the rect is its maximum Y.
+				expected.origin.y -= 10;
+			#endif
+
+			expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(expected)));
+		}
+	});
+});
+
 describe(@"RCLAlignment", ^{
 	itBehavesLike(MacroBindingExamples, ^{
 		return @{
@@ -781,6 +817,456 @@ describe(@"RCLAlignment", ^{
 	});
 });
 
+describe(@"coalescing", ^{
+	__block RACTestScheduler *scheduler;
+	__block TestView *view;
+	__block RACSubject *rects;
+
+	beforeEach(^{
+		scheduler = [[RACTestScheduler alloc] init];
+		[RCLRectAssignmentTrampoline setCoalescingScheduler:scheduler];
+
+		view = [[TestView alloc] initWithFrame:CGRectZero];
+		rects = [RACSubject subject];
+	});
+
+	afterEach(^{
+		[RCLRectAssignmentTrampoline setCoalescingScheduler:nil];
+	});
+
+	it(@"should only assign the latest rect", ^{
+		RCLFrame(view) = @{
+			rcl_rect: rects
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(5, 6, 7, 8))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectZero)));
+
+		[scheduler stepAll];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(5, 6, 7, 8))));
+	});
+
+	it(@"should assign rects staged while flushing", ^{
+		TestView *otherView = [[TestView alloc] initWithFrame:CGRectZero];
+
+		RCLFrame(view) = @{
+			rcl_rect: rects
+		};
+
+		RCLFrame(otherView) = @{
+			rcl_rect: view.rcl_frameSignal,
+			rcl_left: @20
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[scheduler step];
+
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(1, 2, 3, 4))));
+		expect(MEDBox(otherView.rcl_frame)).to(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+	});
+
+	it(@"should not affect bindings created before it was enabled", ^{
+		[RCLRectAssignmentTrampoline setCoalescingScheduler:nil];
+
+		RCLFrame(view) = @{
+			rcl_rect: rects
+		};
+
+		[RCLRectAssignmentTrampoline setCoalescingScheduler:scheduler];
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(1, 2, 3, 4))));
+	});
+});
+
+describe(@"background layout", ^{
+	__block RACTestScheduler *evaluationScheduler;
+	__block RACTestScheduler *commitScheduler;
+	__block TestView *view;
+	__block RACSubject *rects;
+
+	beforeEach(^{
+		evaluationScheduler = [[RACTestScheduler alloc] init];
+		commitScheduler = [[RACTestScheduler alloc] init];
+
+		[RCLRectAssignmentTrampoline setCoalescingScheduler:commitScheduler];
+		[RCLRectAssignmentTrampoline setBackgroundLayoutScheduler:evaluationScheduler];
+
+		view = [[TestView alloc] initWithFrame:CGRectZero];
+		rects = [RACSubject subject];
+
+		RCLFrame(view) = @{
+			rcl_rect: rects,
+			rcl_left: @20
+		};
+	});
+
+	afterEach(^{
+		[RCLRectAssignmentTrampoline setBackgroundLayoutScheduler:nil];
+		[RCLRectAssignmentTrampoline setCoalescingScheduler:nil];
+	});
+
+	it(@"should evaluate upon the background scheduler, then commit", ^{
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectZero)));
+
+		[evaluationScheduler stepAll];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectZero)));
+
+		[commitScheduler stepAll];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+	});
+
+	it(@"should commit all evaluated rects together", ^{
+		TestView *otherView = [[TestView alloc] initWithFrame:CGRectZero];
+
+		RCLFrame(otherView) = @{
+			rcl_rect: rects,
+			rcl_width: @50
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(5, 6, 7, 8))];
+
+		[evaluationScheduler step];
+		[commitScheduler step];
+
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(20, 6, 7, 8))));
+		expect(MEDBox(otherView.rcl_frame)).to(equal(MEDBox(CGRectMake(5, 6, 50, 8))));
+	});
+
+	it(@"should evaluate upstream geometry operators upon the background scheduler", ^{
+		RCLProfiler *profiler = RCLProfiler.sharedProfiler;
+		[profiler reset];
+		profiler.enabled = YES;
+
+		// Sums of this many signals are maintained incrementally, so they
+		// aren't fused into the operators that use them.
+		RACSubject *widths = [RACSubject subject];
+		NSMutableArray *addends = [NSMutableArray arrayWithObject:widths];
+		for (NSUInteger i = 0; i < 7; i++) {
+			[addends addObject:[RACSignal return:@1]];
+		}
+
+		TestView *otherView = [[TestView alloc] initWithFrame:CGRectZero];
+		RCLFrame(otherView) = @{
+			rcl_rect: rects,
+			rcl_width: [RACSignal add:addends]
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[widths sendNext:@43];
+		expect([profiler.nodes valueForKeyPath:@"@sum.evaluationCount"]).to(equal(@0));
+
+		__block BOOL evaluatedOnMainThread = YES;
+		dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+
+		dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+			evaluatedOnMainThread = NSThread.isMainThread;
+			[evaluationScheduler stepAll];
+			dispatch_semaphore_signal(semaphore);
+		});
+
+		dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+
+		// At least both bindings, and the sum upstream of one of them.
+		expect(@(evaluatedOnMainThread)).to(beFalsy());
+		expect([profiler.nodes valueForKeyPath:@"@sum.evaluationCount"]).to(beGreaterThanOrEqualTo(@3));
+
+		profiler.enabled = NO;
+		[profiler reset];
+
+		[commitScheduler stepAll];
+		expect(MEDBox(otherView.rcl_frame)).to(equal(MEDBox(CGRectMake(1, 2, 50, 4))));
+	});
+
+	it(@"should read the geometry of input views upon the main thread", ^{
+		TestView *sourceView = [[TestView alloc] initWithFrame:CGRectZero];
+		TestView *otherView = [[TestView alloc] initWithFrame:CGRectZero];
+
+		RCLFrame(otherView) = @{
+			rcl_rect: sourceView.rcl_frameSignal,
+			rcl_width: @50
+		};
+
+		sourceView.frame = CGRectMake(1, 2, 3, 4);
+
+		dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+		dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+			[evaluationScheduler stepAll];
+			dispatch_semaphore_signal(semaphore);
+		});
+
+		dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+		expect(@(sourceView.readGeometryOffMainThread)).to(beFalsy());
+
+		[commitScheduler stepAll];
+		expect(MEDBox(otherView.rcl_frame)).to(equal(MEDBox(CGRectMake(1, 2, 50, 4))));
+	});
+});
+
+describe(@"lazy layout", ^{
+	__block RACTestScheduler *scheduler;
+	__block TestView *superview;
+	__block TestView *view;
+	__block RACSubject *rects;
+
+	beforeEach(^{
+		scheduler = [[RACTestScheduler alloc] init];
+		[RCLRectAssignmentTrampoline setLazyLayoutScheduler:scheduler];
+
+		superview = [[TestView alloc] initWithFrame:CGRectMake(0, 0, 100, 100)];
+		view = [[TestView alloc] initWithFrame:CGRectZero];
+		[superview addSubview:view];
+
+		rects = [RACSubject subject];
+
+		RCLFrame(view) = @{
+			rcl_rect: rects,
+			rcl_left: @20
+		};
+	});
+
+	afterEach(^{
+		[RCLRectAssignmentTrampoline setLazyLayoutScheduler:nil];
+	});
+
+	it(@"should not lay out views outside of a window", ^{
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[scheduler stepAll];
+
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectZero)));
+	});
+
+	it(@"should lay out a subtree on demand", ^{
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(5, 6, 7, 8))];
+
+		[RCLRectAssignmentTrampoline layoutViewIfNeeded:superview];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(20, 6, 7, 8))));
+	});
+
+	it(@"should lay out views that are dirtied while laying out", ^{
+		TestView *otherView = [[TestView alloc] initWithFrame:CGRectZero];
+		[superview addSubview:otherView];
+
+		RCLFrame(otherView) = @{
+			rcl_rect: view.rcl_frameSignal,
+			rcl_width: @50
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[RCLRectAssignmentTrampoline layoutViewIfNeeded:superview];
+
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+		expect(MEDBox(otherView.rcl_frame)).to(equal(MEDBox(CGRectMake(20, 2, 50, 4))));
+	});
+
+	describe(@"in a window", ^{
+		#ifdef RCL_FOR_IPHONE
+			__block UIWindow *window;
+		#else
+			__block NSWindow *window;
+		#endif
+
+		// Moves `superview` into the window.
+		__block void (^addToWindow)(void);
+
+		beforeEach(^{
+			#ifdef RCL_FOR_IPHONE
+				window = [[UIWindow alloc] initWithFrame:CGRectMake(0, 0, 500, 500)];
+				window.hidden = NO;
+
+				addToWindow = [^{
+					[window addSubview:superview];
+				} copy];
+			#else
+				window = [[NSWindow alloc] initWithContentRect:CGRectMake(0, 0, 500, 500) styleMask:NSBorderlessWindowMask backing:NSBackingStoreBuffered defer:YES];
+				window.releasedWhenClosed = NO;
+
+				addToWindow = [^{
+					[window.contentView addSubview:superview];
+				} copy];
+			#endif
+		});
+
+		afterEach(^{
+			#ifdef RCL_FOR_IPHONE
+				window.hidden = YES;
+			#else
+				[window close];
+			#endif
+		});
+
+		it(@"should lay out a view when it's added to a window", ^{
+			[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+			[scheduler stepAll];
+			expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectZero)));
+
+			addToWindow();
+			expect(MEDBox(view.rcl_frame)).toEventually(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+		});
+
+		it(@"should lay out a view when it's unhidden", ^{
+			addToWindow();
+			view.hidden = YES;
+
+			[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+			[scheduler stepAll];
+			expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectZero)));
+
+			view.hidden = NO;
+			expect(MEDBox(view.rcl_frame)).toEventually(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+		});
+
+		it(@"should lay out a view when a superview is unhidden", ^{
+			addToWindow();
+			superview.hidden = YES;
+
+			[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+			[scheduler stepAll];
+			expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectZero)));
+
+			superview.hidden = NO;
+			expect(MEDBox(view.rcl_frame)).toEventually(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+		});
+
+		it(@"should lay out a view outside of the window's bounds", ^{
+			addToWindow();
+			superview.frame = CGRectMake(1000, 1000, 100, 100);
+
+			[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+			[scheduler stepAll];
+			expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+		});
+
+		it(@"should lay out views upon the main thread", ^{
+			addToWindow();
+			[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+
+			dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+			dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+				[scheduler stepAll];
+				dispatch_semaphore_signal(semaphore);
+			});
+
+			dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+
+			expect(MEDBox(view.rcl_frame)).toEventually(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+			expect(@(view.readGeometryOffMainThread)).to(beFalsy());
+		});
+	});
+
+	it(@"should not affect views outside of the subtree", ^{
+		TestView *otherView = [[TestView alloc] initWithFrame:CGRectZero];
+
+		RCLFrame(otherView) = @{
+			rcl_rect: rects
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[RCLRectAssignmentTrampoline layoutViewIfNeeded:superview];
+
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(20, 2, 3, 4))));
+		expect(MEDBox(otherView.rcl_frame)).to(equal(MEDBox(CGRectZero)));
+	});
+});
+
+describe(@"change tolerance", ^{
+	__block TestView *view;
+	__block RACSubject *rects;
+
+	beforeEach(^{
+		view = [[TestView alloc] initWithFrame:CGRectZero];
+		rects = [RACSubject subject];
+	});
+
+	afterEach(^{
+		[RCLRectAssignmentTrampoline setChangeTolerance:0];
+	});
+
+	it(@"should assign every change by default", ^{
+		RCLFrame(view) = @{
+			rcl_rect: rects
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(1.25, 2, 3, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(1.25, 2, 3, 4))));
+	});
+
+	it(@"should skip changes within the global tolerance", ^{
+		[RCLRectAssignmentTrampoline setChangeTolerance:0.5];
+		expect(@(RCLRectAssignmentTrampoline.changeTolerance)).to(equal(@0.5));
+
+		RCLFrame(view) = @{
+			rcl_rect: rects,
+			rcl_width: @10
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(1, 2, 10, 4))));
+
+		[rects sendNext:MEDBox(CGRectMake(1.25, 2.5, 30, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(1, 2, 10, 4))));
+
+		[rects sendNext:MEDBox(CGRectMake(2, 2, 3, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(2, 2, 10, 4))));
+	});
+
+	it(@"should compare against the last rect sent, not the last one received", ^{
+		[RCLRectAssignmentTrampoline setChangeTolerance:0.5];
+
+		RCLFrame(view) = @{
+			rcl_rect: rects
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(1.25, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(1.5, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(1.75, 2, 3, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(1.75, 2, 3, 4))));
+	});
+
+	it(@"should use the tolerance of a binding instead of the global one", ^{
+		[RCLRectAssignmentTrampoline setChangeTolerance:10];
+
+		RCLFrame(view) = @{
+			rcl_rect: rects,
+			rcl_tolerance: @0
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(2, 2, 3, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(2, 2, 3, 4))));
+
+		TestView *otherView = [[TestView alloc] initWithFrame:CGRectZero];
+		[RCLRectAssignmentTrampoline setChangeTolerance:0];
+
+		RCLFrame(otherView) = @{
+			rcl_rect: rects,
+			rcl_tolerance: @1
+		};
+
+		[rects sendNext:MEDBox(CGRectMake(5, 6, 7, 8))];
+		[rects sendNext:MEDBox(CGRectMake(5.5, 6, 7, 8))];
+		expect(MEDBox(otherView.rcl_frame)).to(equal(MEDBox(CGRectMake(5, 6, 7, 8))));
+	});
+
+	it(@"should not affect bindings created before it was set", ^{
+		RCLFrame(view) = @{
+			rcl_rect: rects
+		};
+
+		[RCLRectAssignmentTrampoline setChangeTolerance:0.5];
+
+		[rects sendNext:MEDBox(CGRectMake(1, 2, 3, 4))];
+		[rects sendNext:MEDBox(CGRectMake(1.25, 2, 3, 4))];
+		expect(MEDBox(view.rcl_frame)).to(equal(MEDBox(CGRectMake(1.25, 2, 3, 4))));
+	});
+});
+
 describe(@"RCLBox", ^{
 	it(@"should create a constant signal of int", ^{
 		RACSignal *signal = RCLBox(INT_MIN);
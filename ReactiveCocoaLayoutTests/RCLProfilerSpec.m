@@ -0,0 +1,135 @@
+//
+//  RCLProfilerSpec.m
+//  ReactiveCocoaLayout
+//
+//  Created by GitHub on 2026-10-17.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Archimedes/Archimedes.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+#import <ReactiveCocoa/ReactiveCocoa.h>
+#import <ReactiveCocoaLayout/ReactiveCocoaLayout.h>
+
+QuickSpecBegin(RCLProfilerSpec)
+
+__block RCLProfiler *profiler;
+__block RACSubject *subject;
+__block RACSignal *signal;
+
+beforeEach(^{
+	profiler = RCLProfiler.sharedProfiler;
+	[profiler reset];
+
+	subject = [RACSubject subject];
+	signal = [[subject alignLeft:[RACSignal return:@5]] width];
+	[signal subscribeNext:^(id _) {}];
+});
+
+afterEach(^{
+	profiler.enabled = NO;
+	[profiler reset];
+});
+
+it(@"should not record anything while disabled", ^{
+	[subject sendNext:MEDBox(CGRectMake(0, 0, 10, 10))];
+	expect(profiler.nodes).to(equal(@[]));
+});
+
+it(@"should record evaluations while enabled", ^{
+	profiler.enabled = YES;
+
+	[subject sendNext:MEDBox(CGRectMake(0, 0, 10, 10))];
+	[subject sendNext:MEDBox(CGRectMake(0, 0, 20, 10))];
+
+	NSArray *operators = [profiler.nodes filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"geometryOperator == YES"]];
+	expect(@(operators.count)).to(equal(@1));
+
+	RCLProfilerNode *node = operators[0];
+	expect(@(node.evaluationCount)).to(equal(@2));
+	expect(@(node.sentCount)).to(equal(@2));
+	expect(@(node.suppressedCount)).to(equal(@0));
+	expect(@(node.totalTime)).to(beGreaterThanOrEqualTo(@(node.peakTime)));
+	expect(@(node.operandIdentifiers.count)).to(equal(@2));
+});
+
+it(@"should record skipped values as suppressed", ^{
+	profiler.enabled = YES;
+
+	RACSignal *distinctSignal = [subject.size.height distinctGeometry];
+	[distinctSignal subscribeNext:^(id _) {}];
+
+	[subject sendNext:MEDBox(CGRectMake(0, 0, 10, 10))];
+	[subject sendNext:MEDBox(CGRectMake(0, 0, 20, 10))];
+
+	// The operator created in -beforeEach sends both values.
+	NSArray *nodes = [profiler.nodes filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"geometryOperator == YES AND suppressedCount > 0"]];
+	expect(@(nodes.count)).to(equal(@1));
+
+	RCLProfilerNode *node = nodes[0];
+	expect(@(node.evaluationCount)).to(equal(@2));
+	expect(@(node.sentCount)).to(equal(@1));
+	expect(@(node.suppressedCount)).to(equal(@1));
+	expect(@(node.emptyCount)).to(equal(@0));
+});
+
+it(@"should record evaluations without a value separately from suppressed ones", ^{
+	profiler.enabled = YES;
+
+	RACSubject *numberSubject = [RACSubject subject];
+	[[RACSignal max:@[ numberSubject ]] subscribeNext:^(id _) {}];
+
+	[numberSubject sendNext:@5];
+	[numberSubject sendNext:NSNull.null];
+	[numberSubject sendNext:@5];
+
+	NSArray *nodes = [profiler.nodes filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"geometryOperator == YES AND emptyCount > 0"]];
+	expect(@(nodes.count)).to(equal(@1));
+
+	RCLProfilerNode *node = nodes[0];
+	expect(@(node.evaluationCount)).to(equal(@3));
+	expect(@(node.sentCount)).to(equal(@1));
+	expect(@(node.suppressedCount)).to(equal(@1));
+	expect(@(node.emptyCount)).to(equal(@1));
+});
+
+it(@"should record the signals combined by each operator", ^{
+	profiler.enabled = YES;
+	[subject sendNext:MEDBox(CGRectMake(0, 0, 10, 10))];
+
+	NSArray *nodes = profiler.nodes;
+	expect(@(nodes.count)).to(equal(@3));
+
+	RCLProfilerNode *operatorNode = [nodes filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"geometryOperator == YES"]][0];
+	NSSet *identifiers = [NSSet setWithArray:[nodes valueForKey:@"identifier"]];
+
+	for (NSString *identifier in operatorNode.operandIdentifiers) {
+		expect(@([identifiers containsObject:identifier])).to(beTruthy());
+	}
+});
+
+it(@"should export the graph as DOT", ^{
+	profiler.enabled = YES;
+	[subject sendNext:MEDBox(CGRectMake(0, 0, 10, 10))];
+
+	NSString *DOT = profiler.DOTRepresentation;
+	expect(@([DOT hasPrefix:@"digraph RCL {"])).to(beTruthy());
+	expect(@([DOT componentsSeparatedByString:@" -> "].count - 1)).to(equal(@2));
+});
+
+it(@"should export the graph as JSON", ^{
+	profiler.enabled = YES;
+	[subject sendNext:MEDBox(CGRectMake(0, 0, 10, 10))];
+
+	NSDictionary *JSON = [NSJSONSerialization JSONObjectWithData:profiler.JSONRepresentation options:0 error:NULL];
+	NSArray *nodes = JSON[@"nodes"];
+	expect(@(nodes.count)).to(equal(@3));
+
+	NSDictionary *operatorNode = [nodes filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"geometryOperator == YES"]][0];
+	expect(operatorNode[@"evaluations"]).to(equal(@1));
+	expect(operatorNode[@"sent"]).to(equal(@1));
+	expect(operatorNode[@"empty"]).to(equal(@0));
+});
+
+QuickSpecEnd
@@ -18,6 +18,10 @@
 
 #endif
 
+// Whether -frame or -bounds has been read on a thread other than the main
+// thread.
+@property (atomic, assign, readonly) BOOL readGeometryOffMainThread;
+
 // Insets the given frame by 1 point horizontally and 2 points vertically.
 - (CGRect)alignmentRectForFrame:(CGRect)frame;
 
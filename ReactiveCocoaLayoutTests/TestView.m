@@ -12,6 +12,7 @@
 
 @property (nonatomic, assign) CGSize size;
 @property (nonatomic, strong) id baselineView;
+@property (atomic, assign, readwrite) BOOL readGeometryOffMainThread;
 
 @end
 
@@ -37,6 +38,16 @@
 	return self;
 }
 
+- (CGRect)frame {
+	if (!NSThread.isMainThread) self.readGeometryOffMainThread = YES;
+	return super.frame;
+}
+
+- (CGRect)bounds {
+	if (!NSThread.isMainThread) self.readGeometryOffMainThread = YES;
+	return super.bounds;
+}
+
 #ifdef RCL_FOR_IPHONE
 - (UIView *)viewForBaselineLayout {
 	return self.baselineView;
@@ -14,6 +14,25 @@
 
 #import "ViewExamples.h"
 
+// Uses an arbitrary subview for its baseline, which can be changed at any time.
+@interface BaselineView : UIView
+
+@property (nonatomic, strong) UIView *baselineView;
+
+@end
+
+@implementation BaselineView
+
++ (NSSet *)keyPathsForValuesAffectingViewForBaselineLayout {
+	return [NSSet setWithObject:@keypath(BaselineView.new, baselineView)];
+}
+
+- (UIView *)viewForBaselineLayout {
+	return self.baselineView ?: self;
+}
+
+@end
+
 QuickSpecBegin(UIViewRCLGeometryAdditions)
 
 itBehavesLike(ViewExamples, nil);
@@ -42,4 +61,40 @@ describe(@"UILabel", ^{
 	});
 });
 
+describe(@"dynamic baseline view", ^{
+	__block BaselineView *view;
+	__block UIView *subview;
+
+	beforeEach(^{
+		view = [[BaselineView alloc] initWithFrame:CGRectMake(0, 0, 100, 50)];
+		subview = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 100, 30)];
+		[view addSubview:subview];
+	});
+
+	it(@"should follow changes to the baseline view", ^{
+		__block NSNumber *lastBaseline = nil;
+		[view.rcl_baselineSignal subscribeNext:^(NSNumber *baseline) {
+			lastBaseline = baseline;
+		}];
+
+		expect(lastBaseline).to(equal(@0));
+
+		view.baselineView = subview;
+		expect(lastBaseline).to(equal(@20));
+
+		subview.frame = CGRectMake(0, 0, 100, 40);
+		expect(lastBaseline).to(equal(@10));
+
+		view.baselineView = nil;
+		expect(lastBaseline).to(equal(@0));
+	});
+
+	it(@"should read the baseline view when subscribed", ^{
+		RACSignal *signal = view.rcl_baselineSignal;
+
+		view.baselineView = subview;
+		expect([signal first]).to(equal(@20));
+	});
+});
+
 QuickSpecEnd
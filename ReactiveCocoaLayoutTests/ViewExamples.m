@@ -12,11 +12,21 @@
 #import <ReactiveCocoa/ReactiveCocoa.h>
 #import <ReactiveCocoaLayout/ReactiveCocoaLayout.h>
 
+#import <malloc/malloc.h>
+#import <objc/runtime.h>
+
 #import "TestView.h"
 #import "ViewExamples.h"
 
 NSString * const ViewExamples = @"ViewExamples";
 
+// Returns the number of bytes currently allocated by the process.
+static size_t allocatedBytes(void) {
+	malloc_statistics_t statistics;
+	malloc_zone_statistics(NULL, &statistics);
+	return statistics.size_in_use;
+}
+
 QuickConfigurationBegin(ViewExampleGroups)
 
 + (void)configure:(Configuration *)configuration {
@@ -193,6 +203,47 @@ QuickConfigurationBegin(ViewExampleGroups)
 				setNewSize();
 				expect(lastValue).to(beCloseTo(@(newSize.height)));
 			});
+
+			it(@"should reuse intrinsic size signals", ^{
+				expect(@(view.rcl_intrinsicContentSizeSignal == view.rcl_intrinsicContentSizeSignal)).to(beTruthy());
+				expect(@(view.rcl_intrinsicBoundsSignal == view.rcl_intrinsicBoundsSignal)).to(beTruthy());
+				expect(@(view.rcl_intrinsicWidthSignal == view.rcl_intrinsicWidthSignal)).to(beTruthy());
+				expect(@(view.rcl_intrinsicHeightSignal == view.rcl_intrinsicHeightSignal)).to(beTruthy());
+			});
+
+			it(@"should only instrument views whose intrinsic content size is observed", ^{
+				TestView *otherView = [[TestView alloc] initWithFrame:initialFrame];
+
+				[view.rcl_intrinsicContentSizeSignal subscribeNext:^(id _) {}];
+				expect(object_getClass(view)).notTo(equal(TestView.class));
+				expect(object_getClass(otherView)).to(equal(TestView.class));
+			});
+
+			it(@"should not grow when intrinsic and baseline signals are requested repeatedly", ^{
+				// Create everything once, so only repeated requests are
+				// measured.
+				RACSignal *sizeSignal = view.rcl_intrinsicContentSizeSignal;
+				RACSignal *baselineSignal = view.rcl_baselineSignal;
+
+				size_t initialBytes = allocatedBytes();
+				NSUInteger newSignals = 0;
+
+				for (NSUInteger i = 0; i < 100000; i++) {
+					@autoreleasepool {
+						if (view.rcl_intrinsicContentSizeSignal != sizeSignal) newSignals++;
+						if (view.rcl_baselineSignal != baselineSignal) newSignals++;
+					}
+				}
+
+				expect(@(newSignals)).to(equal(@0));
+
+				// The whole process is measured, so allow for some unrelated
+				// allocations. Anything retained for each of the 200,000
+				// requests would take at least one 16-byte malloc block, or
+				// 3.2 MB in total, which is over three times this bound.
+				size_t finalBytes = allocatedBytes();
+				expect(@(finalBytes < initialBytes + 1024 * 1024)).to(beTruthy());
+			});
 		});
 
 		it(@"should send values on rcl_alignmentRectSignal", ^{
@@ -209,6 +260,30 @@ QuickConfigurationBegin(ViewExampleGroups)
 			expect(lastValue).to(equal(MEDBox(CGRectMake(11, 22, 28, 36))));
 		});
 
+		it(@"should share rcl_alignmentRectSignal between subscribers", ^{
+			RACSignal *signal = view.rcl_alignmentRectSignal;
+			expect(@(signal == view.rcl_alignmentRectSignal)).to(beTruthy());
+
+			__block NSValue *firstValue = nil;
+			__block NSValue *secondValue = nil;
+
+			RACDisposable *firstDisposable = [signal subscribeNext:^(NSValue *value) {
+				firstValue = value;
+			}];
+
+			[signal subscribeNext:^(NSValue *value) {
+				secondValue = value;
+			}];
+
+			expect(secondValue).to(equal(MEDBox(CGRectMake(101, 202, 298, 396))));
+
+			[firstDisposable dispose];
+			view.frame = CGRectMake(10, 20, 30, 40);
+
+			expect(firstValue).to(equal(MEDBox(CGRectMake(101, 202, 298, 396))));
+			expect(secondValue).to(equal(MEDBox(CGRectMake(11, 22, 28, 36))));
+		});
+
 		it(@"should read rcl_alignmentRect", ^{
 			expect(MEDBox(view.rcl_alignmentRect)).to(equal(MEDBox(CGRectMake(101, 202, 298, 396))));
 